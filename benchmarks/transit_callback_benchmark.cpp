@@ -0,0 +1,333 @@
+// Microbenchmark of transit callback evaluation over several matrix layouts.
+//
+// Every layout is evaluated through a std::function taking routing indices,
+// as RoutingModel::RegisterTransitCallback stores it, so only the lookup
+// differs:
+//   nested        IndexToNode, then vector<vector<double>>, the original
+//                 RegisterTransitCallback lambda
+//   flat64        IndexToNode, then FlatMatrix::Wide
+//   flat32        IndexToNode, then FlatMatrix::Narrow after Compact()
+//   index64       matrix reordered by routing index, no IndexToNode
+//   index32       the same in 32 bits
+// Access patterns:
+//   random        uniformly random index pairs
+//   local         from nodes walk between spatial neighbors and every from is
+//                 evaluated against its nearest neighbors, as neighborhood
+//                 operators do
+// Reports ns/eval and, where perf_event_open is allowed, cache misses and
+// L1 data read misses per eval.
+//
+// Build against the OR-tools in include/ and lib/ used by cgo:
+//   cmake -S benchmarks -B build/benchmarks
+//   cmake --build build/benchmarks
+// Pass -DORTOOLS_ROOT=<dir> for an install elsewhere.
+// Usage: transit_callback_benchmark [num_nodes] [num_vehicles] [evals]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ortools/constraint_solver/routing_index_manager.h"
+
+#include "flat_matrix.h"
+
+namespace {
+using operations_research::RoutingIndexManager;
+using TransitCallback = std::function<int64_t(int64_t, int64_t)>;
+
+constexpr int kRepetitions = 5;
+constexpr int kNeighbors = 16;
+constexpr int kClusters = 20;
+
+// Hardware counter read around a measured loop; reports nothing when
+// perf_event is unavailable (non-Linux, containers, perf_event_paranoid).
+class PerfCounter {
+public:
+  enum Event { kCacheMisses, kL1ReadMisses };
+
+  explicit PerfCounter(Event event) {
+#ifdef __linux__
+    perf_event_attr attr = {};
+    attr.size = sizeof(attr);
+    if (event == kCacheMisses) {
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    } else {
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_L1D |
+                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    (void)event;
+#endif
+  }
+  ~PerfCounter() {
+#ifdef __linux__
+    if (fd >= 0) {
+      close(fd);
+    }
+#endif
+  }
+  PerfCounter(const PerfCounter &) = delete;
+  PerfCounter &operator=(const PerfCounter &) = delete;
+
+  void Start() {
+#ifdef __linux__
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+  // Events since Start, or -1.
+  int64_t Stop() {
+#ifdef __linux__
+    uint64_t count = 0;
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+        return count;
+      }
+    }
+#endif
+    return -1;
+  }
+
+private:
+  int fd = -1;
+};
+
+struct Layout {
+  std::string name;
+  TransitCallback callback;
+};
+
+struct Result {
+  double ns_per_eval = 0;
+  double cache_misses = -1;
+  double l1_misses = -1;
+};
+
+// Clustered points, so that neighbors are close but not adjacent in node
+// order, as with customers read from a file.
+std::vector<std::vector<double>> MakeMatrix(int num_nodes,
+                                            std::mt19937 *random) {
+  std::uniform_real_distribution<double> coordinate(0, 100000);
+  std::normal_distribution<double> spread(0, 2000);
+  std::vector<std::pair<double, double>> centers(kClusters);
+  for (auto &center : centers) {
+    center = {coordinate(*random), coordinate(*random)};
+  }
+  std::vector<std::pair<double, double>> points(num_nodes);
+  for (auto &point : points) {
+    const auto &center = centers[(*random)() % kClusters];
+    point = {center.first + spread(*random), center.second + spread(*random)};
+  }
+  std::vector<std::vector<double>> matrix(num_nodes,
+                                          std::vector<double>(num_nodes));
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = 0; to < num_nodes; ++to) {
+      matrix[from][to] = std::round(
+          std::hypot(points[from].first - points[to].first,
+                     points[from].second - points[to].second));
+    }
+  }
+  return matrix;
+}
+
+std::vector<std::pair<int64_t, int64_t>>
+RandomPairs(int num_indices, int64_t evals, std::mt19937 *random) {
+  std::vector<std::pair<int64_t, int64_t>> pairs(evals);
+  for (auto &pair : pairs) {
+    pair = {(*random)() % num_indices, (*random)() % num_indices};
+  }
+  return pairs;
+}
+
+std::vector<std::pair<int64_t, int64_t>>
+LocalPairs(const RoutingIndexManager &manager,
+           const std::vector<std::vector<double>> &matrix, int64_t evals,
+           std::mt19937 *random) {
+  const int num_indices = manager.num_indices();
+  std::vector<std::vector<int64_t>> neighbors(num_indices);
+  std::vector<int64_t> candidates(num_indices);
+  for (int64_t from = 0; from < num_indices; ++from) {
+    for (int64_t to = 0; to < num_indices; ++to) {
+      candidates[to] = to;
+    }
+    const int from_node = manager.IndexToNode(from).value();
+    const int kept = std::min(kNeighbors, num_indices);
+    std::partial_sort(
+        candidates.begin(), candidates.begin() + kept, candidates.end(),
+        [&](int64_t a, int64_t b) {
+          return matrix[from_node][manager.IndexToNode(a).value()] <
+                 matrix[from_node][manager.IndexToNode(b).value()];
+        });
+    neighbors[from].assign(candidates.begin(), candidates.begin() + kept);
+  }
+  std::vector<std::pair<int64_t, int64_t>> pairs;
+  pairs.reserve(evals);
+  int64_t from = (*random)() % num_indices;
+  while (static_cast<int64_t>(pairs.size()) < evals) {
+    for (int64_t to : neighbors[from]) {
+      if (static_cast<int64_t>(pairs.size()) == evals) {
+        break;
+      }
+      pairs.emplace_back(from, to);
+    }
+    // Mostly a neighbor, sometimes a jump elsewhere as after a route change.
+    from = (*random)() % 8 == 0 ? (*random)() % num_indices
+                                : neighbors[from][(*random)() %
+                                                  neighbors[from].size()];
+  }
+  return pairs;
+}
+
+// Best of kRepetitions passes over pairs; counters come from that pass.
+Result Measure(const TransitCallback &callback,
+               const std::vector<std::pair<int64_t, int64_t>> &pairs) {
+  PerfCounter cache_misses(PerfCounter::kCacheMisses);
+  PerfCounter l1_misses(PerfCounter::kL1ReadMisses);
+  Result best;
+  best.ns_per_eval = -1;
+  int64_t sum = 0;
+  for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+    cache_misses.Start();
+    l1_misses.Start();
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &pair : pairs) {
+      sum += callback(pair.first, pair.second);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const int64_t cache_count = cache_misses.Stop();
+    const int64_t l1_count = l1_misses.Stop();
+    const double ns =
+        std::chrono::duration<double, std::nano>(end - start).count() /
+        pairs.size();
+    if (best.ns_per_eval < 0 || ns < best.ns_per_eval) {
+      best.ns_per_eval = ns;
+      best.cache_misses =
+          cache_count < 0 ? -1 : static_cast<double>(cache_count) / pairs.size();
+      best.l1_misses =
+          l1_count < 0 ? -1 : static_cast<double>(l1_count) / pairs.size();
+    }
+  }
+  // Keeps the loads from being optimized away.
+  if (sum == 42) {
+    std::printf(" ");
+  }
+  return best;
+}
+
+std::string FormatCount(double count) {
+  if (count < 0) {
+    return "n/a";
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", count);
+  return buffer;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  const int num_nodes = argc > 1 ? std::atoi(argv[1]) : 2000;
+  const int num_vehicles = argc > 2 ? std::atoi(argv[2]) : 20;
+  const int64_t evals = argc > 3 ? std::atoll(argv[3]) : 4000000;
+  if (num_nodes < 2 || num_vehicles < 1 || evals < 1) {
+    std::fprintf(stderr,
+                 "usage: %s [num_nodes] [num_vehicles] [evals]\n", argv[0]);
+    return 1;
+  }
+  std::mt19937 random(1);
+  const std::vector<std::vector<double>> nested = MakeMatrix(num_nodes, &random);
+  const RoutingIndexManager manager(num_nodes, num_vehicles,
+                                    RoutingIndexManager::NodeIndex(0));
+  const RoutingIndexManager *manager_ptr = &manager;
+  const int num_indices = manager.num_indices();
+
+  constraint_solver::FlatMatrix flat64(nested);
+  constraint_solver::FlatMatrix flat32(nested);
+  flat32.Compact();
+  std::vector<int64_t> index64(static_cast<size_t>(num_indices) * num_indices);
+  for (int64_t from = 0; from < num_indices; ++from) {
+    for (int64_t to = 0; to < num_indices; ++to) {
+      index64[from * num_indices + to] =
+          flat64(manager.IndexToNode(from).value(),
+                 manager.IndexToNode(to).value());
+    }
+  }
+  constraint_solver::FlatMatrix index32(num_indices, index64);
+  index32.Compact();
+  const std::vector<int64_t> *index64_ptr = &index64;
+
+  std::vector<Layout> layouts;
+  // The original RegisterTransitCallback lambda.
+  layouts.push_back(
+      {"nested", [data = &nested, manager = manager_ptr](
+                     int64_t from_index, int64_t to_index) -> int64_t {
+         auto from_node = manager->IndexToNode(from_index).value();
+         auto to_node = manager->IndexToNode(to_index).value();
+         return (*data)[from_node][to_node];
+       }});
+  layouts.push_back(
+      {"flat64", [matrix = &flat64, manager = manager_ptr](
+                     int64_t from_index, int64_t to_index) -> int64_t {
+         return matrix->Wide(manager->IndexToNode(from_index).value(),
+                             manager->IndexToNode(to_index).value());
+       }});
+  layouts.push_back(
+      {"flat32", [matrix = &flat32, manager = manager_ptr](
+                     int64_t from_index, int64_t to_index) -> int64_t {
+         return matrix->Narrow(manager->IndexToNode(from_index).value(),
+                               manager->IndexToNode(to_index).value());
+       }});
+  layouts.push_back(
+      {"index64", [values = index64_ptr, num_indices](
+                      int64_t from_index, int64_t to_index) -> int64_t {
+         return (*values)[from_index * num_indices + to_index];
+       }});
+  layouts.push_back(
+      {"index32", [matrix = &index32](int64_t from_index,
+                                      int64_t to_index) -> int64_t {
+         return matrix->Narrow(from_index, to_index);
+       }});
+
+  const std::vector<std::pair<std::string,
+                              std::vector<std::pair<int64_t, int64_t>>>>
+      patterns = {{"random", RandomPairs(num_indices, evals, &random)},
+                  {"local", LocalPairs(manager, nested, evals, &random)}};
+
+  std::printf("nodes %d  vehicles %d  indices %d  evals %lld\n", num_nodes,
+              num_vehicles, num_indices, static_cast<long long>(evals));
+  std::printf("%-8s %-8s %10s %14s %14s\n", "pattern", "layout", "ns/eval",
+              "misses/eval", "l1d/eval");
+  for (const auto &pattern : patterns) {
+    for (const Layout &layout : layouts) {
+      const Result result = Measure(layout.callback, pattern.second);
+      std::printf("%-8s %-8s %10.2f %14s %14s\n", pattern.first.c_str(),
+                  layout.name.c_str(), result.ns_per_eval,
+                  FormatCount(result.cache_misses).c_str(),
+                  FormatCount(result.l1_misses).c_str());
+    }
+  }
+  return 0;
+}
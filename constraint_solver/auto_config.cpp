@@ -0,0 +1,241 @@
+#include "auto_config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ortools/constraint_solver/routing_enums.pb.h"
+
+namespace constraint_solver {
+namespace {
+constexpr int kFeatureSampleRows = 256;
+
+SearchRule MakeRule(const std::string &first_solution_strategy,
+                    const std::string &metaheuristic,
+                    double search_time_fraction) {
+  SearchRule rule;
+  rule.first_solution_strategy = first_solution_strategy;
+  rule.metaheuristic = metaheuristic;
+  rule.search_time_fraction = search_time_fraction;
+  return rule;
+}
+
+// Whether the setters accept both names, so a typo or an enum value they do
+// not map fails the load instead of leaving the search settings unchanged.
+bool ValidRuleNames(const SearchRule &rule) {
+  operations_research::FirstSolutionStrategy_Value strategy;
+  operations_research::LocalSearchMetaheuristic_Value metaheuristic;
+  return ParseFirstSolutionStrategy(rule.first_solution_strategy,
+                                    &strategy) &&
+         ParseLocalSearchMetaheuristic(rule.metaheuristic, &metaheuristic);
+}
+} // namespace
+
+bool ParseFirstSolutionStrategy(
+    const std::string &name,
+    operations_research::FirstSolutionStrategy_Value *strategy) {
+  static const std::unordered_map<
+      std::string, operations_research::FirstSolutionStrategy_Value>
+      strategyMap = {
+          {"AUTOMATIC", operations_research::FirstSolutionStrategy::AUTOMATIC},
+          {"PATH_CHEAPEST_ARC",
+           operations_research::FirstSolutionStrategy::PATH_CHEAPEST_ARC},
+          {"PATH_MOST_CONSTRAINED_ARC",
+           operations_research::FirstSolutionStrategy::PATH_MOST_CONSTRAINED_ARC},
+          {"EVALUATOR_STRATEGY",
+           operations_research::FirstSolutionStrategy::EVALUATOR_STRATEGY},
+          {"SAVINGS", operations_research::FirstSolutionStrategy::SAVINGS},
+          {"SWEEP", operations_research::FirstSolutionStrategy::SWEEP},
+          {"CHRISTOFIDES",
+           operations_research::FirstSolutionStrategy::CHRISTOFIDES},
+          {"ALL_UNPERFORMED",
+           operations_research::FirstSolutionStrategy::ALL_UNPERFORMED},
+          {"BEST_INSERTION",
+           operations_research::FirstSolutionStrategy::BEST_INSERTION},
+          {"PARALLEL_CHEAPEST_INSERTION",
+           operations_research::FirstSolutionStrategy::PARALLEL_CHEAPEST_INSERTION},
+          {"SEQUENTIAL_CHEAPEST_INSERTION",
+           operations_research::FirstSolutionStrategy::SEQUENTIAL_CHEAPEST_INSERTION},
+          {"LOCAL_CHEAPEST_INSERTION",
+           operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_INSERTION},
+          {"LOCAL_CHEAPEST_COST_INSERTION",
+           operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_COST_INSERTION},
+          {"GLOBAL_CHEAPEST_ARC",
+           operations_research::FirstSolutionStrategy::GLOBAL_CHEAPEST_ARC},
+          {"LOCAL_CHEAPEST_ARC",
+           operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_ARC},
+          {"FIRST_UNBOUND_MIN_VALUE",
+           operations_research::FirstSolutionStrategy::FIRST_UNBOUND_MIN_VALUE}};
+
+  auto it = strategyMap.find(name);
+  if (it == strategyMap.end()) {
+    return false;
+  }
+  *strategy = it->second;
+  return true;
+}
+
+bool ParseLocalSearchMetaheuristic(
+    const std::string &name,
+    operations_research::LocalSearchMetaheuristic_Value *metaheuristic) {
+  static const std::unordered_map<
+      std::string, operations_research::LocalSearchMetaheuristic_Value>
+      metaheuristicMap = {
+          {"AUTOMATIC", operations_research::LocalSearchMetaheuristic::AUTOMATIC},
+          {"GREEDY_DESCENT",
+           operations_research::LocalSearchMetaheuristic::GREEDY_DESCENT},
+          {"GUIDED_LOCAL_SEARCH",
+           operations_research::LocalSearchMetaheuristic::GUIDED_LOCAL_SEARCH},
+          {"SIMULATED_ANNEALING",
+           operations_research::LocalSearchMetaheuristic::SIMULATED_ANNEALING},
+          {"TABU_SEARCH", operations_research::LocalSearchMetaheuristic::TABU_SEARCH},
+          {"GENERIC_TABU_SEARCH",
+           operations_research::LocalSearchMetaheuristic::GENERIC_TABU_SEARCH}};
+
+  auto it = metaheuristicMap.find(name);
+  if (it == metaheuristicMap.end()) {
+    return false;
+  }
+  *metaheuristic = it->second;
+  return true;
+}
+
+InstanceFeatures ComputeInstanceFeatures(
+    const FlatMatrix &matrix, int num_vehicles,
+    const std::vector<int64_t> &demands,
+    const std::vector<int64_t> &vehicle_capacities) {
+  InstanceFeatures features;
+  const int num_nodes = matrix.size();
+  features.num_nodes = num_nodes;
+  features.num_vehicles = num_vehicles;
+
+  double total_demand = 0;
+  for (int64_t demand : demands) {
+    total_demand += demand;
+  }
+  double total_capacity = 0;
+  for (int64_t capacity : vehicle_capacities) {
+    total_capacity += capacity;
+  }
+  if (!demands.empty() && total_capacity > 0) {
+    features.capacity_tightness = total_demand / total_capacity;
+  }
+  if (num_nodes < 2) {
+    return features;
+  }
+
+  // Rows spread evenly over the nodes.
+  const int sample_rows = std::min(num_nodes, kFeatureSampleRows);
+  double nearest_sum = 0;
+  double distance_sum = 0;
+  double asymmetry_sum = 0;
+  double pair_sum = 0;
+  for (int sample = 0; sample < sample_rows; ++sample) {
+    const int from = static_cast<int64_t>(sample) * num_nodes / sample_rows;
+    int64_t nearest = std::numeric_limits<int64_t>::max();
+    for (int to = 0; to < num_nodes; ++to) {
+      if (to == from) {
+        continue;
+      }
+      const int64_t forward = matrix(from, to);
+      const int64_t backward = matrix(to, from);
+      nearest = std::min(nearest, forward);
+      distance_sum += forward;
+      asymmetry_sum += std::abs(forward - backward);
+      pair_sum += forward + backward;
+    }
+    nearest_sum += nearest;
+  }
+  const double mean_distance = distance_sum / (sample_rows * (num_nodes - 1.0));
+  if (mean_distance > 0) {
+    features.clustering =
+        nearest_sum / sample_rows / mean_distance * std::sqrt(num_nodes);
+  }
+  if (pair_sum > 0) {
+    features.asymmetry = asymmetry_sum / pair_sum;
+  }
+  return features;
+}
+
+std::vector<SearchRule> DefaultSearchRules() {
+  std::vector<SearchRule> rules;
+  // Small instances: the search converges well within any reasonable limit.
+  rules.push_back(
+      MakeRule("PATH_CHEAPEST_ARC", "GUIDED_LOCAL_SEARCH", 1.0));
+  rules.back().max_nodes = 200;
+  // Tight capacities: insertion builds feasible routes where arc-based
+  // strategies strand the last customers.
+  rules.push_back(
+      MakeRule("PARALLEL_CHEAPEST_INSERTION", "GUIDED_LOCAL_SEARCH", 0.8));
+  rules.back().min_tightness = 0.85;
+  // Clustered customers: savings merges clusters into routes cheaply.
+  rules.push_back(MakeRule("SAVINGS", "GUIDED_LOCAL_SEARCH", 0.7));
+  rules.back().max_clustering = 0.5;
+  // Asymmetric matrices (one-way streets): insertion handles direction.
+  rules.push_back(
+      MakeRule("LOCAL_CHEAPEST_INSERTION", "GUIDED_LOCAL_SEARCH", 0.8));
+  rules.back().min_asymmetry = 0.2;
+  // Large instances: local search stalls, so ruin and recreate gets half.
+  rules.push_back(MakeRule("SAVINGS", "GUIDED_LOCAL_SEARCH", 0.5));
+  rules.back().min_nodes = 1000;
+  rules.push_back(
+      MakeRule("PATH_CHEAPEST_ARC", "GUIDED_LOCAL_SEARCH", 0.8));
+  return rules;
+}
+
+bool LoadSearchRules(const std::string &path, std::vector<SearchRule> *rules) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::vector<SearchRule> loaded;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string first;
+    if (!(fields >> first) || first[0] == '#') {
+      continue;
+    }
+    fields.str(line);
+    fields.clear();
+    SearchRule rule;
+    std::string extra;
+    if (!(fields >> rule.min_nodes >> rule.max_nodes >> rule.min_tightness >>
+          rule.max_tightness >> rule.min_clustering >> rule.max_clustering >>
+          rule.min_asymmetry >> rule.max_asymmetry >>
+          rule.first_solution_strategy >> rule.metaheuristic >>
+          rule.search_time_fraction) ||
+        (fields >> extra) || rule.search_time_fraction <= 0 ||
+        rule.search_time_fraction > 1 || !ValidRuleNames(rule)) {
+      return false;
+    }
+    loaded.push_back(rule);
+  }
+  *rules = std::move(loaded);
+  return true;
+}
+
+int MatchSearchRule(const std::vector<SearchRule> &rules,
+                    const InstanceFeatures &features) {
+  for (size_t i = 0; i < rules.size(); ++i) {
+    const SearchRule &rule = rules[i];
+    if (features.num_nodes >= rule.min_nodes &&
+        features.num_nodes <= rule.max_nodes &&
+        features.capacity_tightness >= rule.min_tightness &&
+        features.capacity_tightness <= rule.max_tightness &&
+        features.clustering >= rule.min_clustering &&
+        features.clustering <= rule.max_clustering &&
+        features.asymmetry >= rule.min_asymmetry &&
+        features.asymmetry <= rule.max_asymmetry) {
+      return i;
+    }
+  }
+  return -1;
+}
+} // namespace constraint_solver
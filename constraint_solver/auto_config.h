@@ -0,0 +1,81 @@
+#ifndef AUTO_CONFIG_H
+#define AUTO_CONFIG_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flat_matrix.h"
+#include "ortools/constraint_solver/routing_enums.pb.h"
+
+namespace constraint_solver {
+// Cheap summary of an instance used to pick search settings.
+struct InstanceFeatures {
+  int num_nodes = 0;
+  int num_vehicles = 0;
+  // Total demand over total capacity; 0 without demands.
+  double capacity_tightness = 0;
+  // Mean nearest-neighbor distance over mean distance, times sqrt(nodes):
+  // about 1 for uniformly spread nodes, lower when they are clustered.
+  double clustering = 0;
+  // Sum of |d(i, j) - d(j, i)| over sum of d(i, j) + d(j, i): 0 for a
+  // symmetric matrix.
+  double asymmetry = 0;
+};
+
+// Computes the features from a sample of at most 256 matrix rows, so the
+// cost stays linear in the number of nodes.
+InstanceFeatures ComputeInstanceFeatures(
+    const FlatMatrix &matrix, int num_vehicles,
+    const std::vector<int64_t> &demands,
+    const std::vector<int64_t> &vehicle_capacities);
+
+// Settings applied to instances whose features lie in every range.
+struct SearchRule {
+  int min_nodes = 0;
+  int max_nodes = 1 << 30;
+  double min_tightness = 0;
+  double max_tightness = 1e9;
+  double min_clustering = 0;
+  double max_clustering = 1e9;
+  double min_asymmetry = 0;
+  double max_asymmetry = 1e9;
+  // Names accepted by SetFirstSolutionStrategy and
+  // SetLocalSearchMetaheuristic.
+  std::string first_solution_strategy;
+  std::string metaheuristic;
+  // Share of the time limit given to the routing search; the rest goes to
+  // ruin and recreate post-optimization.
+  double search_time_fraction = 1;
+};
+
+// Strategy and metaheuristic names accepted by
+// RoutingWrapper::SetFirstSolutionStrategy and SetLocalSearchMetaheuristic,
+// and so by search rules. Return false, leaving the value unchanged, for any
+// other name, including enum values the wrapper does not map such as
+// PARALLEL_SAVINGS.
+bool ParseFirstSolutionStrategy(
+    const std::string &name,
+    operations_research::FirstSolutionStrategy_Value *strategy);
+bool ParseLocalSearchMetaheuristic(
+    const std::string &name,
+    operations_research::LocalSearchMetaheuristic_Value *metaheuristic);
+
+// Built-in rules, ending with a catch-all.
+std::vector<SearchRule> DefaultSearchRules();
+
+// Reads rules from a text file, one per line with whitespace-separated
+// fields in SearchRule order:
+//   min_nodes max_nodes min_tightness max_tightness min_clustering
+//   max_clustering min_asymmetry max_asymmetry first_solution_strategy
+//   metaheuristic search_time_fraction
+// Blank lines and lines starting with '#' are skipped. Returns false,
+// leaving rules untouched, on a malformed line or a strategy or
+// metaheuristic name the parsers above reject.
+bool LoadSearchRules(const std::string &path, std::vector<SearchRule> *rules);
+
+// Index of the first rule matching features, or -1.
+int MatchSearchRule(const std::vector<SearchRule> &rules,
+                    const InstanceFeatures &features);
+} // namespace constraint_solver
+
+#endif
@@ -1,8 +1,13 @@
 #include "constraint_solver.h"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <iostream>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "InstanceCVRPLIB.h"
@@ -11,43 +16,510 @@
 #include "ortools/constraint_solver/routing_index_manager.h"
 #include "ortools/constraint_solver/routing_parameters.h"
 
+#include "flat_matrix.h"
+#include "lower_bound.h"
+#include "route_improvement.h"
+
 namespace constraint_solver {
+namespace {
+// Rough sizes of OR-tools objects used by the memory estimate.
+constexpr int64_t kBytesPerModelVariable = 160;
+constexpr int64_t kBytesPerAssignmentElement = 32;
+// Assignments alive during a search (collectors, preassignment, ...).
+constexpr int64_t kStoredAssignments = 4;
+// Bytes per candidate neighbor kept by the insertion heuristics.
+constexpr int64_t kBytesPerNeighbor = 16;
+// The routing model caches every transit callback in a dense matrix up to
+// this many nodes (RoutingModelParameters.max_callback_cache_size).
+constexpr int64_t kMaxCachedCallbackNodes = 2048;
+// Neighbor pruning never goes below this ratio.
+constexpr double kMinNeighborsRatio = 0.05;
+// Transit and arrival functions the model caches for every arc of a state
+// dependent transit callback; no downgrade shrinks them.
+constexpr int64_t kBytesPerStateDependentTransit = 100;
 
-RoutingWrapper::RoutingWrapper() {}
+template <typename Lookup, typename Arc>
+operations_research::RoutingModel::TransitCallback2
+ArcCallback(const operations_research::RoutingIndexManager *manager,
+            Lookup lookup, Arc arc) {
+  return [manager, lookup, arc](int64_t from_index,
+                                int64_t to_index) -> int64_t {
+    // Convert from routing variable Index to distance matrix NodeIndex.
+    const int from_node = manager->IndexToNode(from_index).value();
+    const int to_node = manager->IndexToNode(to_index).value();
+    return arc(lookup(from_node, to_node), from_node);
+  };
+}
+
+// Callback returning arc(distance, from_node) for every arc. The distance
+// lookup is picked from the storage the model has now, so calls do not
+// branch on it; the storage must not change while the routing model lives.
+template <typename Arc>
+operations_research::RoutingModel::TransitCallback2
+DistanceCallback(const DataModel &data,
+                 const operations_research::RoutingIndexManager *manager,
+                 Arc arc) {
+  if (data.distance_oracle != nullptr) {
+    LazyDistanceOracle *oracle = data.distance_oracle.get();
+    return ArcCallback(
+        manager,
+        [oracle](int from, int to) { return oracle->Distance(from, to); },
+        arc);
+  }
+  const FlatMatrix *matrix = &data.flat_distance_matrix;
+  if (matrix->compact()) {
+    return ArcCallback(
+        manager, [matrix](int from, int to) { return matrix->Narrow(from, to); },
+        arc);
+  }
+  return ArcCallback(
+      manager, [matrix](int from, int to) { return matrix->Wide(from, to); },
+      arc);
+}
+} // namespace
+
+RoutingWrapper::RoutingWrapper()
+    : firstSolutionStrategy(operations_research::FirstSolutionStrategy::UNSET),
+      localSearchMetaheuristic(
+          operations_research::LocalSearchMetaheuristic::UNSET),
+      searchRules(DefaultSearchRules()), solution(nullptr) {}
 
 void RoutingWrapper::InitDataModel(
     std::vector<std::vector<double>> distance_matrix, int num_vehicles,
     int depotIndex) {
-  data.distance_matrix = distance_matrix;
+  data.flat_distance_matrix = FlatMatrix(distance_matrix);
+  data.distance_oracle.reset();
   data.num_vehicles = num_vehicles;
   operations_research::RoutingIndexManager::NodeIndex depot(depotIndex);
   data.depot = depot;
-  // data.vehicle_capacities = std::vector<int64_t>(num_vehicles, 36);
+  ResetInstanceData();
+}
+
+bool RoutingWrapper::InitFlatDataModel(std::vector<int64_t> distances,
+                                       int num_nodes, int num_vehicles,
+                                       int depotIndex) {
+  if (num_nodes <= 0 || num_vehicles <= 0 || depotIndex < 0 || depotIndex >= num_nodes ||
+      distances.size() != static_cast<size_t>(num_nodes) * num_nodes) {
+    return false;
+  }
+  data.flat_distance_matrix = FlatMatrix(num_nodes, std::move(distances));
+  data.distance_oracle.reset();
+  data.num_vehicles = num_vehicles;
+  data.depot = operations_research::RoutingIndexManager::NodeIndex(depotIndex);
+  ResetInstanceData();
+  return true;
+}
+
+void RoutingWrapper::ResetInstanceData() {
+  data.starts.clear();
+  data.ends.clear();
+  data.demands.clear();
+  data.vehicle_capacities.clear();
+  data.service_times.clear();
+  data.vehicle_classes.clear();
+  data.class_cost_multipliers.clear();
+  data.class_speed_factors.clear();
+  data.class_fixed_costs.clear();
+  data.node_longitudes.clear();
+  data.node_latitudes.clear();
+  // Profiles are not tied to nodes and stay registered.
+  data.node_zones.clear();
+  data.zone_profiles.clear();
+  data.num_zones = 0;
+  stopGroups = StopGroups();
+  // The model was built over the previous instance.
+  solution = nullptr;
+  routing.reset();
+  manager.reset();
+}
+
+bool RoutingWrapper::LoadNodeVertices(const std::string &graph_path,
+                                      const std::vector<int64_t> &node_vertices,
+                                      int num_vehicles, int depotIndex,
+                                      RoadGraph *graph,
+                                      std::vector<int32_t> *vertices) {
+  const int num_nodes = node_vertices.size();
+  if (num_nodes <= 0 || num_vehicles <= 0 || depotIndex < 0 ||
+      depotIndex >= num_nodes || !LoadRoadGraph(graph_path, graph)) {
+    return false;
+  }
+  vertices->resize(num_nodes);
+  for (int node = 0; node < num_nodes; ++node) {
+    if (node_vertices[node] < 0 ||
+        node_vertices[node] >= graph->num_vertices()) {
+      return false;
+    }
+    (*vertices)[node] = node_vertices[node];
+  }
+  return true;
+}
+
+bool RoutingWrapper::InitRoadGraphDataModel(const std::string &graph_path,
+                                            std::vector<int64_t> node_vertices,
+                                            int num_vehicles, int depotIndex,
+                                            int max_cached_rows) {
+  auto graph = std::make_shared<RoadGraph>();
+  std::vector<int32_t> vertices;
+  if (max_cached_rows <= 0 ||
+      !LoadNodeVertices(graph_path, node_vertices, num_vehicles, depotIndex,
+                        graph.get(), &vertices)) {
+    return false;
+  }
+  data.flat_distance_matrix = FlatMatrix();
+  data.distance_oracle = std::make_shared<LazyDistanceOracle>(
+      std::move(graph), std::move(vertices), max_cached_rows);
+  data.num_vehicles = num_vehicles;
+  data.depot = operations_research::RoutingIndexManager::NodeIndex(depotIndex);
+  ResetInstanceData();
+  return true;
+}
+
+bool RoutingWrapper::InitRoadGraphMatrixDataModel(
+    const std::string &graph_path, std::vector<int64_t> node_vertices,
+    int num_vehicles, int depotIndex, int num_threads) {
+  RoadGraph graph;
+  std::vector<int32_t> vertices;
+  if (!LoadNodeVertices(graph_path, node_vertices, num_vehicles, depotIndex,
+                        &graph, &vertices)) {
+    return false;
+  }
+  data.distance_oracle.reset();
+  BuildDistanceMatrix(graph, vertices, num_threads,
+                      &data.flat_distance_matrix);
+  data.num_vehicles = num_vehicles;
+  data.depot = operations_research::RoutingIndexManager::NodeIndex(depotIndex);
+  ResetInstanceData();
+  return true;
+}
+
+bool RoutingWrapper::SetVehicleStartsAndEnds(std::vector<int64_t> starts,
+                                             std::vector<int64_t> ends) {
+  const int64_t num_nodes = data.num_nodes();
+  if (starts.size() != static_cast<size_t>(data.num_vehicles) ||
+      ends.size() != static_cast<size_t>(data.num_vehicles)) {
+    return false;
+  }
+  auto in_range = [num_nodes](int64_t node) {
+    return node >= 0 && node < num_nodes;
+  };
+  if (!std::all_of(starts.begin(), starts.end(), in_range) ||
+      !std::all_of(ends.begin(), ends.end(), in_range)) {
+    return false;
+  }
+  data.starts.clear();
+  data.ends.clear();
+  data.starts.reserve(data.num_vehicles);
+  data.ends.reserve(data.num_vehicles);
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    data.starts.emplace_back(starts[vehicle]);
+    data.ends.emplace_back(ends[vehicle]);
+  }
+  return true;
+}
+
+bool RoutingWrapper::SetVehicleClasses(std::vector<int64_t> vehicle_classes,
+                                       std::vector<double> cost_multipliers,
+                                       std::vector<double> speed_factors,
+                                       std::vector<int64_t> fixed_costs) {
+  const int64_t num_classes = cost_multipliers.size();
+  if (vehicle_classes.size() != static_cast<size_t>(data.num_vehicles) ||
+      speed_factors.size() != cost_multipliers.size() ||
+      fixed_costs.size() != cost_multipliers.size()) {
+    return false;
+  }
+  if (!std::all_of(vehicle_classes.begin(), vehicle_classes.end(),
+                   [num_classes](int64_t vehicle_class) {
+                     return vehicle_class >= 0 && vehicle_class < num_classes;
+                   })) {
+    return false;
+  }
+  // Factors scale and truncate int64 arcs: NaN or infinite ones would make
+  // the conversion undefined, and non-positive ones free or negative arcs.
+  auto positive_finite = [](double factor) {
+    return std::isfinite(factor) && factor > 0;
+  };
+  if (!std::all_of(cost_multipliers.begin(), cost_multipliers.end(),
+                   positive_finite) ||
+      !std::all_of(speed_factors.begin(), speed_factors.end(),
+                   positive_finite) ||
+      !std::all_of(fixed_costs.begin(), fixed_costs.end(),
+                   [](int64_t fixed_cost) { return fixed_cost >= 0; })) {
+    return false;
+  }
+  data.vehicle_classes = std::move(vehicle_classes);
+  data.class_cost_multipliers = std::move(cost_multipliers);
+  data.class_speed_factors = std::move(speed_factors);
+  data.class_fixed_costs = std::move(fixed_costs);
+  return true;
 }
 
 void RoutingWrapper::CreateRoutingIndexManager(DataModel data) {
-  manager = std::make_unique<operations_research::RoutingIndexManager>(
-      data.distance_matrix.size(), data.num_vehicles, data.depot);
+  CreateIndexManager(data);
 }
 
 void RoutingWrapper::CreateRoutingModel() {
-  routing = std::make_unique<operations_research::RoutingModel>(*manager);
+  // Callbacks fix the matrix storage and fill their caches when they are
+  // registered, so the budget is enforced here, before any is. Both
+  // downgrades keep every value; they are applied even if the solve is
+  // later rejected.
+  cacheCallbacks = true;
+  modelOverBudget = false;
+  if (memoryBudget > 0 &&
+      EstimateMemoryFor(searchParameters).total_bytes > memoryBudget) {
+    if (allowMemoryDowngrade) {
+      data.flat_distance_matrix.Compact();
+    }
+    // A model that cannot be solved has no use for the caches either.
+    cacheCallbacks =
+        allowMemoryDowngrade &&
+        EstimateMemoryFor(searchParameters).total_bytes <= memoryBudget;
+    modelOverBudget = !allowMemoryDowngrade;
+  }
+  hasPickupsAndDeliveries = false;
+  pairedIndices.clear();
+  dropPenaltiesSet = false;
+  hasDisjunctions = false;
+  // The solution, the search monitors and the solution callbacks belong to
+  // the model being replaced.
+  solution = nullptr;
+  earlyStopLimitAdded = false;
+  trajectoryCallbackAdded = false;
+  routeLocks.clear();
+  timeDependentDimensions = 0;
+  operations_research::RoutingModelParameters model_parameters =
+      operations_research::DefaultRoutingModelParameters();
+  // The model would otherwise fill a dense cache of every callback up front,
+  // computing all rows of an oracle.
+  if (!cacheCallbacks || data.distance_oracle != nullptr) {
+    model_parameters.set_max_callback_cache_size(0);
+  }
+  routing = std::make_unique<operations_research::RoutingModel>(
+      *manager, model_parameters);
+}
+
+void RoutingWrapper::CreateRoutingModelFromData() {
+  CreateIndexManager(data);
+  CreateRoutingModel();
+}
+
+void RoutingWrapper::CreateIndexManager(const DataModel &model) {
+  if (!model.starts.empty()) {
+    manager = std::make_unique<operations_research::RoutingIndexManager>(
+        model.num_nodes(), model.num_vehicles, model.starts,
+        model.ends);
+    return;
+  }
+  manager = std::make_unique<operations_research::RoutingIndexManager>(
+      model.num_nodes(), model.num_vehicles, model.depot);
 }
 
 int RoutingWrapper::RegisterTransitCallback() {
   // Define cost of each arc.
-  const int transit_callback_index = routing->RegisterTransitCallback(
-      [data = &this->data, manager = manager.get()](
-          int64_t from_index, int64_t to_index) -> int64_t {
-        // Convert from routing variable Index to distance matrix NodeIndex.
-        auto from_node = manager->IndexToNode(from_index).value();
-        auto to_node = manager->IndexToNode(to_index).value();
-        return data->distance_matrix[from_node][to_node];
-      });
-  routing->SetArcCostEvaluatorOfAllVehicles(transit_callback_index);
+  const int transit_callback_index =
+      routing->RegisterTransitCallback(DistanceCallback(
+          data, manager.get(),
+          [](int64_t distance, int) { return distance; }));
+  if (data.vehicle_classes.empty()) {
+    routing->SetArcCostEvaluatorOfAllVehicles(transit_callback_index);
+    return transit_callback_index;
+  }
+
+  // One cost callback per vehicle class, all reading the same base matrix.
+  std::vector<int> class_cost_evaluators(data.class_cost_multipliers.size());
+  for (size_t vehicle_class = 0; vehicle_class < class_cost_evaluators.size();
+       ++vehicle_class) {
+    const double multiplier = data.class_cost_multipliers[vehicle_class];
+    if (multiplier == 1.0) {
+      class_cost_evaluators[vehicle_class] = transit_callback_index;
+      continue;
+    }
+    class_cost_evaluators[vehicle_class] =
+        routing->RegisterTransitCallback(DistanceCallback(
+            data, manager.get(),
+            [multiplier](int64_t distance, int) -> int64_t {
+              return distance * multiplier;
+            }));
+  }
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    const int64_t vehicle_class = data.vehicle_classes[vehicle];
+    routing->SetArcCostEvaluatorOfVehicle(class_cost_evaluators[vehicle_class],
+                                          vehicle);
+    routing->SetFixedCostOfVehicle(data.class_fixed_costs[vehicle_class],
+                                   vehicle);
+  }
   return transit_callback_index;
 }
 
+bool RoutingWrapper::SetDemands(std::vector<int64_t> demands,
+                                std::vector<int64_t> vehicle_capacities) {
+  if (demands.size() != static_cast<size_t>(data.num_nodes()) ||
+      vehicle_capacities.size() != static_cast<size_t>(data.num_vehicles)) {
+    return false;
+  }
+  // Either vector may be empty, e.g. without vehicles.
+  auto negative = [](int64_t value) { return value < 0; };
+  if (std::any_of(demands.begin(), demands.end(), negative) ||
+      std::any_of(vehicle_capacities.begin(), vehicle_capacities.end(),
+                  negative)) {
+    return false;
+  }
+  data.demands = std::move(demands);
+  data.vehicle_capacities = std::move(vehicle_capacities);
+  return true;
+}
+
+bool RoutingWrapper::AddCapacityDimension(const std::string &name) {
+  if (data.demands.size() != static_cast<size_t>(data.num_nodes()) ||
+      data.vehicle_capacities.size() !=
+          static_cast<size_t>(data.num_vehicles)) {
+    return false;
+  }
+  const int demand_callback_index = routing->RegisterUnaryTransitCallback(
+      [data = &this->data, manager = manager.get()](int64_t index) -> int64_t {
+        return data->demands[manager->IndexToNode(index).value()];
+      });
+  return routing->AddDimensionWithVehicleCapacity(
+      demand_callback_index, 0, data.vehicle_capacities, true, name);
+}
+
+bool RoutingWrapper::SetServiceTimes(std::vector<int64_t> service_times) {
+  if (service_times.size() != static_cast<size_t>(data.num_nodes()) ||
+      std::any_of(service_times.begin(), service_times.end(),
+                  [](int64_t service_time) { return service_time < 0; })) {
+    return false;
+  }
+  data.service_times = std::move(service_times);
+  return true;
+}
+
+bool RoutingWrapper::AddTimeDimension(int64_t slack_max, int64_t capacity,
+                                      bool fix_start_cumul_to_zero,
+                                      const std::string &name) {
+  const int time_callback_index =
+      routing->RegisterTransitCallback(DistanceCallback(
+          data, manager.get(),
+          [data = &this->data](int64_t distance, int from_node) {
+            return distance + data->ServiceTime(from_node);
+          }));
+  return routing->AddDimension(time_callback_index, slack_max, capacity,
+                               fix_start_cumul_to_zero, name);
+}
+
+int RoutingWrapper::AggregateColocatedStops() {
+  if (manager != nullptr || data.distance_oracle != nullptr ||
+      !stopGroups.node_group.empty()) {
+    return -1;
+  }
+  const int num_nodes = data.num_nodes();
+  // A super-node heavier than every vehicle could not be served at all.
+  const int64_t max_group_demand =
+      data.demands.empty() || data.vehicle_capacities.empty()
+          ? std::numeric_limits<int64_t>::max()
+          : *std::max_element(data.vehicle_capacities.begin(),
+                              data.vehicle_capacities.end());
+  std::vector<bool> fixed(num_nodes, false);
+  fixed[data.depot.value()] = true;
+  for (size_t vehicle = 0; vehicle < data.starts.size(); ++vehicle) {
+    fixed[data.starts[vehicle].value()] = true;
+    fixed[data.ends[vehicle].value()] = true;
+  }
+  StopGroups groups = FindColocatedStops(
+      data.flat_distance_matrix,
+      HasCoordinates() ? data.node_longitudes : std::vector<double>(),
+      HasCoordinates() ? data.node_latitudes : std::vector<double>(),
+      data.node_zones, data.demands, max_group_demand, fixed);
+  const int num_groups = groups.group_nodes.size();
+  if (num_groups == num_nodes) {
+    return num_nodes;
+  }
+
+  // Every group is represented by its first node.
+  FlatMatrix reduced;
+  reduced.Resize(num_groups);
+  for (int from = 0; from < num_groups; ++from) {
+    int64_t *row = reduced.Row(from);
+    const int from_node = groups.group_nodes[from].front();
+    for (int to = 0; to < num_groups; ++to) {
+      row[to] = data.flat_distance_matrix(from_node,
+                                          groups.group_nodes[to].front());
+    }
+  }
+  data.flat_distance_matrix = std::move(reduced);
+  if (!data.demands.empty()) {
+    data.demands = SumByGroup(groups, data.demands);
+  }
+  if (!data.service_times.empty()) {
+    data.service_times = SumByGroup(groups, data.service_times);
+  }
+  if (!data.node_zones.empty()) {
+    std::vector<int32_t> zones(num_groups);
+    for (int group = 0; group < num_groups; ++group) {
+      zones[group] = data.node_zones[groups.group_nodes[group].front()];
+    }
+    data.node_zones = std::move(zones);
+  }
+  auto to_group = [&groups](
+                      operations_research::RoutingIndexManager::NodeIndex node) {
+    return operations_research::RoutingIndexManager::NodeIndex(
+        groups.node_group[node.value()]);
+  };
+  data.depot = to_group(data.depot);
+  for (size_t vehicle = 0; vehicle < data.starts.size(); ++vehicle) {
+    data.starts[vehicle] = to_group(data.starts[vehicle]);
+    data.ends[vehicle] = to_group(data.ends[vehicle]);
+  }
+  stopGroups = std::move(groups);
+  return num_groups;
+}
+
+std::vector<int64_t> RoutingWrapper::GetNodeGroups() {
+  return std::vector<int64_t>(stopGroups.node_group.begin(),
+                              stopGroups.node_group.end());
+}
+
+int RoutingWrapper::NumOriginalNodes() const {
+  return stopGroups.node_group.empty() ? data.num_nodes()
+                                       : stopGroups.node_group.size();
+}
+
+void RoutingWrapper::AppendOriginalNodes(int64_t node,
+                                         std::vector<int64_t> *nodes) const {
+  if (stopGroups.group_nodes.empty()) {
+    nodes->push_back(node);
+    return;
+  }
+  const std::vector<int> &group = stopGroups.group_nodes[node];
+  nodes->insert(nodes->end(), group.begin(), group.end());
+}
+
+bool RoutingWrapper::AddVehicleClassTimeDimension(
+    int64_t slack_max, int64_t capacity, bool fix_start_cumul_to_zero,
+    const std::string &name) {
+  if (data.vehicle_classes.empty()) {
+    return false;
+  }
+  std::vector<int> class_time_evaluators(data.class_speed_factors.size());
+  for (size_t vehicle_class = 0; vehicle_class < class_time_evaluators.size();
+       ++vehicle_class) {
+    const double speed_factor = data.class_speed_factors[vehicle_class];
+    class_time_evaluators[vehicle_class] =
+        routing->RegisterTransitCallback(DistanceCallback(
+            data, manager.get(),
+            [data = &this->data,
+             speed_factor](int64_t distance, int from_node) -> int64_t {
+              return distance / speed_factor + data->ServiceTime(from_node);
+            }));
+  }
+  std::vector<int> vehicle_time_evaluators(data.num_vehicles);
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    vehicle_time_evaluators[vehicle] =
+        class_time_evaluators[data.vehicle_classes[vehicle]];
+  }
+  return routing->AddDimensionWithVehicleTransits(
+      vehicle_time_evaluators, slack_max, capacity, fix_start_cumul_to_zero,
+      name);
+}
+
 bool RoutingWrapper::AddDimension(int evaluator_index, int slack_max,
                                   int capacity, bool fix_start_cumul_to_zero,
                                   const std::string &name) {
@@ -64,47 +536,857 @@ bool RoutingWrapper::AddDimensionWithVehicleCapacity(
       name);
 }
 
+int RoutingWrapper::AddTravelTimeProfile(std::vector<int64_t> breakpoints,
+                                         std::vector<double> factors) {
+  return data.travel_time_profiles.Add(std::move(breakpoints),
+                                       std::move(factors));
+}
+
+bool RoutingWrapper::SetTravelTimeZones(std::vector<int64_t> node_zones,
+                                        std::vector<int64_t> zone_profiles) {
+  if (node_zones.empty() ||
+      node_zones.size() !=
+          static_cast<size_t>(data.num_nodes())) {
+    return false;
+  }
+  const int64_t num_zones =
+      *std::max_element(node_zones.begin(), node_zones.end()) + 1;
+  const int64_t num_profiles = data.travel_time_profiles.size();
+  if (*std::min_element(node_zones.begin(), node_zones.end()) < 0 ||
+      num_zones > static_cast<int64_t>(node_zones.size()) ||
+      zone_profiles.size() != static_cast<size_t>(num_zones * num_zones) ||
+      !std::all_of(zone_profiles.begin(), zone_profiles.end(),
+                   [num_profiles](int64_t profile) {
+                     return profile >= 0 && profile < num_profiles;
+                   })) {
+    return false;
+  }
+  data.num_zones = num_zones;
+  data.node_zones.assign(node_zones.begin(), node_zones.end());
+  data.zone_profiles.assign(zone_profiles.begin(), zone_profiles.end());
+  return true;
+}
+
+bool RoutingWrapper::AddTimeDependentDimension(int64_t slack_max,
+                                               int64_t horizon,
+                                               bool fix_start_cumul_to_zero,
+                                               const std::string &name) {
+  if (!data.node_zones.empty() &&
+      data.node_zones.size() != static_cast<size_t>(data.num_nodes())) {
+    return false;
+  }
+  if (memoryBudget > 0 && EstimateMemoryFor(searchParameters).total_bytes +
+                                  StateDependentTransitBytes() >
+                              memoryBudget) {
+    return false;
+  }
+  const int transit_callback_index =
+      routing->RegisterStateDependentTransitCallback(
+          [data = &this->data, manager = manager.get()](int64_t from_index,
+                                                        int64_t to_index) {
+            auto from_node = manager->IndexToNode(from_index).value();
+            auto to_node = manager->IndexToNode(to_index).value();
+            const TravelTimeProfile *profile =
+                &data->ArcProfile(from_node, to_node);
+            const int64_t base_time = data->Distance(from_node, to_node);
+            const int64_t service_time = data->ServiceTime(from_node);
+            // The routing model caches one transit per arc and deletes them.
+            return operations_research::RoutingModel::StateDependentTransit{
+                new TimeDependentTransit(profile, base_time, service_time),
+                new TimeDependentArrival(profile, base_time, service_time)};
+          });
+  if (!routing->AddDimensionDependentDimensionWithVehicleCapacity(
+          transit_callback_index, /*base_dimension=*/nullptr, slack_max,
+          horizon, fix_start_cumul_to_zero, name)) {
+    return false;
+  }
+  ++timeDependentDimensions;
+  return true;
+}
+
+bool RoutingWrapper::SetGlobalSpanCostCoefficient(
+    const std::string &dimension_name, int64_t coefficient) {
+  operations_research::RoutingDimension *dimension =
+      routing->GetMutableDimension(dimension_name);
+  if (dimension == nullptr || coefficient < 0) {
+    return false;
+  }
+  dimension->SetGlobalSpanCostCoefficient(coefficient);
+  return true;
+}
+
+bool RoutingWrapper::SetSpanUpperBounds(const std::string &dimension_name,
+                                        std::vector<int64_t> upper_bounds) {
+  operations_research::RoutingDimension *dimension =
+      routing->GetMutableDimension(dimension_name);
+  if (dimension == nullptr ||
+      upper_bounds.size() != static_cast<size_t>(data.num_vehicles)) {
+    return false;
+  }
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    dimension->SetSpanUpperBoundForVehicle(upper_bounds[vehicle], vehicle);
+  }
+  return true;
+}
+
+bool RoutingWrapper::SetCumulSoftUpperBounds(
+    const std::string &dimension_name, std::vector<int64_t> nodes,
+    std::vector<int64_t> upper_bounds, std::vector<int64_t> coefficients) {
+  operations_research::RoutingDimension *dimension =
+      routing->GetMutableDimension(dimension_name);
+  if (dimension == nullptr || upper_bounds.size() != nodes.size() ||
+      coefficients.size() != nodes.size()) {
+    return false;
+  }
+  std::vector<int64_t> indices(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    indices[i] = VisitIndex(nodes[i]);
+    if (indices[i] == operations_research::RoutingIndexManager::kUnassigned) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < indices.size(); ++i) {
+    dimension->SetCumulVarSoftUpperBound(indices[i], upper_bounds[i],
+                                         coefficients[i]);
+  }
+  return true;
+}
+
+bool RoutingWrapper::SetRouteEndSoftUpperBounds(
+    const std::string &dimension_name, std::vector<int64_t> upper_bounds,
+    std::vector<int64_t> coefficients) {
+  operations_research::RoutingDimension *dimension =
+      routing->GetMutableDimension(dimension_name);
+  if (dimension == nullptr ||
+      upper_bounds.size() != static_cast<size_t>(data.num_vehicles) ||
+      coefficients.size() != upper_bounds.size()) {
+    return false;
+  }
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    dimension->SetCumulVarSoftUpperBound(
+        routing->End(vehicle), upper_bounds[vehicle], coefficients[vehicle]);
+  }
+  return true;
+}
+
+bool RoutingWrapper::AddPickupsAndDeliveries(
+    std::vector<int64_t> pickups, std::vector<int64_t> deliveries,
+    const std::string &dimension_name) {
+  operations_research::RoutingDimension *dimension =
+      routing->GetMutableDimension(dimension_name);
+  if (dimension == nullptr || pickups.size() != deliveries.size()) {
+    return false;
+  }
+  std::vector<int64_t> pickup_indices(pickups.size());
+  std::vector<int64_t> delivery_indices(deliveries.size());
+  // Validated on a copy so a rejected call leaves earlier pairs as they are.
+  std::vector<bool> paired = pairedIndices;
+  paired.resize(routing->Size(), false);
+  for (size_t i = 0; i < pickups.size(); ++i) {
+    pickup_indices[i] = VisitIndex(pickups[i]);
+    delivery_indices[i] = VisitIndex(deliveries[i]);
+    if (pickup_indices[i] ==
+            operations_research::RoutingIndexManager::kUnassigned ||
+        delivery_indices[i] ==
+            operations_research::RoutingIndexManager::kUnassigned ||
+        pickup_indices[i] == delivery_indices[i] ||
+        paired[pickup_indices[i]] || paired[delivery_indices[i]]) {
+      return false;
+    }
+    paired[pickup_indices[i]] = true;
+    paired[delivery_indices[i]] = true;
+  }
+  pairedIndices = std::move(paired);
+
+  operations_research::Solver *const solver = routing->solver();
+  for (size_t i = 0; i < pickup_indices.size(); ++i) {
+    const int64_t pickup = pickup_indices[i];
+    const int64_t delivery = delivery_indices[i];
+    routing->AddPickupAndDelivery(pickup, delivery);
+    solver->AddConstraint(solver->MakeEquality(routing->VehicleVar(pickup),
+                                               routing->VehicleVar(delivery)));
+    solver->AddConstraint(solver->MakeLessOrEqual(
+        dimension->CumulVar(pickup), dimension->CumulVar(delivery)));
+  }
+  hasPickupsAndDeliveries = hasPickupsAndDeliveries || !pickups.empty();
+  return true;
+}
+
+bool RoutingWrapper::SetDropPenalties(std::vector<int64_t> penalties) {
+  if (dropPenaltiesSet ||
+      penalties.size() != static_cast<size_t>(data.num_nodes())) {
+    return false;
+  }
+  for (size_t node = 0; node < penalties.size(); ++node) {
+    if (penalties[node] >= 0 &&
+        VisitIndex(node) ==
+            operations_research::RoutingIndexManager::kUnassigned) {
+      return false;
+    }
+  }
+  for (size_t node = 0; node < penalties.size(); ++node) {
+    if (penalties[node] >= 0) {
+      routing->AddDisjunction({VisitIndex(node)}, penalties[node]);
+      hasDisjunctions = true;
+    }
+  }
+  dropPenaltiesSet = true;
+  return true;
+}
+
+bool RoutingWrapper::AddDisjunctionGroups(
+    std::vector<int64_t> nodes, std::vector<int64_t> group_sizes,
+    std::vector<int64_t> penalties, std::vector<int64_t> max_cardinalities) {
+  if (penalties.size() != group_sizes.size() ||
+      max_cardinalities.size() != group_sizes.size()) {
+    return false;
+  }
+  std::vector<int64_t> indices(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    indices[i] = VisitIndex(nodes[i]);
+    if (indices[i] == operations_research::RoutingIndexManager::kUnassigned) {
+      return false;
+    }
+  }
+  size_t total_size = 0;
+  for (size_t group = 0; group < group_sizes.size(); ++group) {
+    if (group_sizes[group] <= 0 || max_cardinalities[group] <= 0) {
+      return false;
+    }
+    total_size += group_sizes[group];
+  }
+  if (total_size != indices.size()) {
+    return false;
+  }
+
+  auto group_begin = indices.begin();
+  for (size_t group = 0; group < group_sizes.size(); ++group) {
+    const auto group_end = group_begin + group_sizes[group];
+    routing->AddDisjunction(std::vector<int64_t>(group_begin, group_end),
+                            penalties[group], max_cardinalities[group]);
+    group_begin = group_end;
+  }
+  hasDisjunctions = hasDisjunctions || !group_sizes.empty();
+  return true;
+}
+
+bool RoutingWrapper::ApplyRouteLocks(std::vector<int64_t> nodes,
+                                     std::vector<int64_t> lock_sizes) {
+  if (lock_sizes.size() != static_cast<size_t>(data.num_vehicles)) {
+    return false;
+  }
+  std::vector<std::vector<int64_t>> locks(data.num_vehicles);
+  std::vector<bool> locked(routing->Size(), false);
+  size_t next = 0;
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    if (lock_sizes[vehicle] < 0 ||
+        lock_sizes[vehicle] > static_cast<int64_t>(nodes.size() - next)) {
+      return false;
+    }
+    for (int64_t i = 0; i < lock_sizes[vehicle]; ++i, ++next) {
+      const int64_t index = VisitIndex(nodes[next]);
+      if (index == operations_research::RoutingIndexManager::kUnassigned ||
+          locked[index]) {
+        return false;
+      }
+      locked[index] = true;
+      locks[vehicle].push_back(index);
+    }
+  }
+  if (next != nodes.size()) {
+    return false;
+  }
+  routeLocks = std::move(locks);
+  return true;
+}
+
+std::vector<int64_t> RoutingWrapper::GetDroppedNodes() {
+  std::vector<int64_t> dropped;
+  if (solution == nullptr) {
+    return dropped;
+  }
+  for (int64_t index = 0; index < routing->Size(); ++index) {
+    if (!routing->IsStart(index) &&
+        solution->Value(routing->NextVar(index)) == index) {
+      AppendOriginalNodes(manager->IndexToNode(index).value(), &dropped);
+    }
+  }
+  return dropped;
+}
+
 void RoutingWrapper::CreateDefaultRoutingSearchParameters() {
   searchParameters = operations_research::DefaultRoutingSearchParameters();
 }
 
+void RoutingWrapper::SetLocalSearchMetaheuristic(std::string metaheuristic) {
+  ParseLocalSearchMetaheuristic(metaheuristic, &localSearchMetaheuristic);
+}
+
+InstanceFeatures RoutingWrapper::GetInstanceFeatures() {
+  return ComputeInstanceFeatures(data.flat_distance_matrix, data.num_vehicles,
+                                 data.demands, data.vehicle_capacities);
+}
+
+bool RoutingWrapper::LoadSearchRules(const std::string &path) {
+  return constraint_solver::LoadSearchRules(path, &searchRules);
+}
+
+SearchRule RoutingWrapper::GetSearchRule(int index) {
+  if (index < 0 || index >= static_cast<int>(searchRules.size())) {
+    return SearchRule();
+  }
+  return searchRules[index];
+}
+
+int RoutingWrapper::AutoConfigure(int64_t time_limit_ms) {
+  if (data.distance_oracle != nullptr) {
+    return -1;
+  }
+  const InstanceFeatures features = GetInstanceFeatures();
+  const int rule_index = MatchSearchRule(searchRules, features);
+  if (rule_index < 0) {
+    return -1;
+  }
+  const SearchRule &rule = searchRules[rule_index];
+  if (!hasPickupsAndDeliveries) {
+    SetFirstSolutionStrategy(rule.first_solution_strategy);
+  }
+  SetLocalSearchMetaheuristic(rule.metaheuristic);
+  const int64_t search_ms = time_limit_ms * rule.search_time_fraction;
+  SetTimeLimit(search_ms);
+  postOptimizationMs = time_limit_ms - search_ms;
+
+  std::ostringstream entry;
+  entry << "auto configuration: rule " << rule_index << " for nodes "
+        << features.num_nodes << " vehicles " << features.num_vehicles
+        << " tightness " << features.capacity_tightness << " clustering "
+        << features.clustering << " asymmetry " << features.asymmetry
+        << "\n";
+  replayLog += entry.str();
+  return rule_index;
+}
+
+bool RoutingWrapper::SolveAutoConfigured(int64_t time_limit_ms,
+                                         int num_threads) {
+  const auto start = std::chrono::steady_clock::now();
+  if (AutoConfigure(time_limit_ms) < 0) {
+    SetTimeLimit(time_limit_ms);
+    postOptimizationMs = 0;
+  }
+  if (!SolveWithCurrentParameters()) {
+    return false;
+  }
+  const int64_t elapsed_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  if (postOptimizationMs > 0 && elapsed_ms < time_limit_ms) {
+    RuinRecreateOptions options;
+    options.iterations = std::numeric_limits<int>::max();
+    options.time_limit_ms = time_limit_ms - elapsed_ms;
+    options.num_threads = num_threads;
+    RunRuinAndRecreate(options);
+  }
+  return true;
+}
+
+void RoutingWrapper::SetTimeLimit(int64_t milliseconds) {
+  searchParameters.mutable_time_limit()->set_seconds(milliseconds / 1000);
+  searchParameters.mutable_time_limit()->set_nanos((milliseconds % 1000) *
+                                                   1000000);
+}
+
 void RoutingWrapper::SetFirstSolutionStrategy(std::string strategy) {
-  std::unordered_map<std::string, operations_research::FirstSolutionStrategy_Value> strategyMap = {
-      {"AUTOMATIC", operations_research::FirstSolutionStrategy::AUTOMATIC},
-      {"PATH_CHEAPEST_ARC", operations_research::FirstSolutionStrategy::PATH_CHEAPEST_ARC},
-      {"PATH_MOST_CONSTRAINED_ARC",
-       operations_research::FirstSolutionStrategy::PATH_MOST_CONSTRAINED_ARC},
-      {"EVALUATOR_STRATEGY", operations_research::FirstSolutionStrategy::EVALUATOR_STRATEGY},
-      {"SAVINGS", operations_research::FirstSolutionStrategy::SAVINGS},
-      {"SWEEP", operations_research::FirstSolutionStrategy::SWEEP},
-      {"CHRISTOFIDES", operations_research::FirstSolutionStrategy::CHRISTOFIDES},
-      {"ALL_UNPERFORMED", operations_research::FirstSolutionStrategy::ALL_UNPERFORMED},
-      {"BEST_INSERTION", operations_research::FirstSolutionStrategy::BEST_INSERTION},
-      {"PARALLEL_CHEAPEST_INSERTION",
-       operations_research::FirstSolutionStrategy::PARALLEL_CHEAPEST_INSERTION},
-      {"SEQUENTIAL_CHEAPEST_INSERTION",
-       operations_research::FirstSolutionStrategy::SEQUENTIAL_CHEAPEST_INSERTION},
-      {"LOCAL_CHEAPEST_INSERTION",
-       operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_INSERTION},
-      {"LOCAL_CHEAPEST_COST_INSERTION",
-       operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_COST_INSERTION},
-      {"GLOBAL_CHEAPEST_ARC", operations_research::FirstSolutionStrategy::GLOBAL_CHEAPEST_ARC},
-      {"LOCAL_CHEAPEST_ARC", operations_research::FirstSolutionStrategy::LOCAL_CHEAPEST_ARC},
-      {"FIRST_UNBOUND_MIN_VALUE",
-       operations_research::FirstSolutionStrategy::FIRST_UNBOUND_MIN_VALUE}};
-
-  auto it = strategyMap.find(strategy);
-  if (it != strategyMap.end()) {
-    firstSolutionStrategy = it->second;
-  }
-}
-
-void RoutingWrapper::SolveWithCurrentParameters() {
-  solution = routing->SolveWithParameters(searchParameters);
+  ParseFirstSolutionStrategy(strategy, &firstSolutionStrategy);
 }
-} // namespace constraint_solver
 
-// int main(int /*argc*/, char * /*argv*/[]) {
-//   constraint_solver::VrpGlobalSpan();
-//   return EXIT_SUCCESS;
-// }
+bool RoutingWrapper::SetDeterministicMode(int32_t seed,
+                                         int64_t solution_limit) {
+  // A limit of 0 is rejected by the parameter validation, so the solve would
+  // fail without a solution.
+  if (solution_limit <= 0) {
+    return false;
+  }
+  deterministic = true;
+  deterministicSeed = seed;
+  deterministicSolutionLimit = solution_limit;
+  return true;
+}
+
+LowerBound RoutingWrapper::ComputeLowerBound(int num_threads) {
+  LowerBound bound;
+  if (!data.demands.empty()) {
+    bound.min_vehicles =
+        MinVehiclesForCapacity(data.demands, data.vehicle_capacities);
+  }
+  // The distance bound assumes every node is visited once by routes from and
+  // to the depot, over the full matrix.
+  if (hasDisjunctions || !data.starts.empty() ||
+      data.distance_oracle != nullptr || bound.min_vehicles < 0) {
+    return bound;
+  }
+  const double cheapest_multiplier =
+      data.class_cost_multipliers.empty()
+          ? 1.0
+          : *std::min_element(data.class_cost_multipliers.begin(),
+                              data.class_cost_multipliers.end());
+  if (cheapest_multiplier == 1.0) {
+    bound.objective = RouteDistanceLowerBound(
+        data.flat_distance_matrix, data.depot.value(), bound.min_vehicles,
+        data.num_vehicles, HasSolution() ? GetObjectiveValue() : 0,
+        num_threads);
+    return bound;
+  }
+  // Class cost callbacks truncate every scaled arc, so scaling the summed
+  // bound can exceed the real cost; bound the truncated arcs instead.
+  const FlatMatrix &distances = data.flat_distance_matrix;
+  FlatMatrix cheapest_costs;
+  cheapest_costs.Resize(distances.size());
+  for (int from = 0; from < distances.size(); ++from) {
+    int64_t *row = cheapest_costs.Row(from);
+    for (int to = 0; to < distances.size(); ++to) {
+      row[to] = distances(from, to) * cheapest_multiplier;
+    }
+  }
+  bound.objective = RouteDistanceLowerBound(
+      cheapest_costs, data.depot.value(), bound.min_vehicles,
+      data.num_vehicles, HasSolution() ? GetObjectiveValue() : 0, num_threads);
+  return bound;
+}
+
+void RoutingWrapper::SetEarlyStopGap(double relative_gap, int num_threads) {
+  earlyStopGap = relative_gap;
+  earlyStopThreads = num_threads;
+}
+
+void RoutingWrapper::SetMemoryBudget(int64_t budget_bytes,
+                                     bool allow_downgrade) {
+  memoryBudget = budget_bytes;
+  allowMemoryDowngrade = allow_downgrade;
+}
+
+MemoryEstimate RoutingWrapper::EstimateMemory() {
+  return EstimateMemoryFor(searchParameters);
+}
+
+int64_t RoutingWrapper::StateDependentTransitBytes() const {
+  const int64_t num_indices = data.num_nodes() + 2 * data.num_vehicles;
+  return num_indices * num_indices * kBytesPerStateDependentTransit;
+}
+
+MemoryEstimate RoutingWrapper::EstimateMemoryFor(
+    const operations_research::RoutingSearchParameters &parameters) const {
+  MemoryEstimate estimate;
+  const int64_t num_nodes = data.num_nodes();
+  const int64_t num_vehicles = data.num_vehicles;
+  estimate.matrix_bytes = data.flat_distance_matrix.ByteSize() +
+                           data.node_zones.capacity() * sizeof(int32_t) +
+                           data.zone_profiles.capacity() * sizeof(uint16_t);
+  if (data.distance_oracle != nullptr) {
+    estimate.matrix_bytes += data.distance_oracle->ByteSize();
+  }
+
+  // index_to_node, node_to_index and the vehicle start and end tables.
+  const int64_t num_indices = num_nodes + 2 * num_vehicles;
+  estimate.index_manager_bytes =
+      num_indices * sizeof(int) + num_nodes * sizeof(int64_t) +
+      4 * num_vehicles * sizeof(int64_t);
+
+  // Next, vehicle and active variables per index, plus cumul, transit and
+  // slack per index and dimension; one cached matrix per callback.
+  const int64_t num_dimensions =
+      routing != nullptr ? routing->GetDimensions().size() : 1;
+  const int64_t num_variables = num_indices * (3 + 3 * num_dimensions);
+  estimate.model_bytes = num_variables * kBytesPerModelVariable;
+  if (num_indices <= kMaxCachedCallbackNodes && cacheCallbacks &&
+      data.distance_oracle == nullptr) {
+    estimate.model_bytes +=
+        (1 + num_dimensions) * num_indices * num_indices * sizeof(int64_t);
+  }
+  estimate.model_bytes +=
+      timeDependentDimensions * StateDependentTransitBytes();
+
+  const double neighbors_ratio =
+      std::max(parameters.cheapest_insertion_first_solution_neighbors_ratio(),
+               parameters.cheapest_insertion_ls_operator_neighbors_ratio());
+  estimate.search_bytes =
+      static_cast<int64_t>(neighbors_ratio * num_indices * num_indices *
+                           kBytesPerNeighbor) +
+      kStoredAssignments * num_variables * kBytesPerAssignmentElement;
+
+  estimate.total_bytes = estimate.matrix_bytes + estimate.index_manager_bytes +
+                         estimate.model_bytes + estimate.search_bytes;
+  return estimate;
+}
+
+bool RoutingWrapper::FitMemoryBudget(
+    operations_research::RoutingSearchParameters *parameters) const {
+  const int64_t current_bytes = EstimateMemoryFor(*parameters).total_bytes;
+  if (current_bytes <= memoryBudget) {
+    return true;
+  }
+  if (!allowMemoryDowngrade) {
+    return false;
+  }
+
+  // Search memory grows linearly with the neighbors ratio: scale it down to
+  // what is left of the budget. Planned on a copy, so parameters only change
+  // if the plan fits.
+  operations_research::RoutingSearchParameters planned = *parameters;
+  const double current_ratio =
+      std::max(planned.cheapest_insertion_first_solution_neighbors_ratio(),
+               planned.cheapest_insertion_ls_operator_neighbors_ratio());
+  planned.set_cheapest_insertion_first_solution_neighbors_ratio(0);
+  planned.set_cheapest_insertion_ls_operator_neighbors_ratio(0);
+  const int64_t fixed_bytes = EstimateMemoryFor(planned).total_bytes;
+  double ratio = kMinNeighborsRatio;
+  if (current_bytes > fixed_bytes && memoryBudget > fixed_bytes) {
+    ratio = std::max(kMinNeighborsRatio,
+                     current_ratio * (memoryBudget - fixed_bytes) /
+                         (current_bytes - fixed_bytes));
+  }
+  planned.set_cheapest_insertion_first_solution_neighbors_ratio(ratio);
+  planned.set_cheapest_insertion_ls_operator_neighbors_ratio(ratio);
+  if (EstimateMemoryFor(planned).total_bytes > memoryBudget) {
+    return false;
+  }
+  *parameters = std::move(planned);
+  return true;
+}
+
+bool RoutingWrapper::SolveWithCurrentParameters() {
+  operations_research::RoutingSearchParameters parameters = searchParameters;
+  if (firstSolutionStrategy !=
+      operations_research::FirstSolutionStrategy::UNSET) {
+    parameters.set_first_solution_strategy(firstSolutionStrategy);
+  } else if (hasPickupsAndDeliveries) {
+    parameters.set_first_solution_strategy(
+        operations_research::FirstSolutionStrategy::PARALLEL_CHEAPEST_INSERTION);
+  }
+  if (localSearchMetaheuristic !=
+      operations_research::LocalSearchMetaheuristic::UNSET) {
+    parameters.set_local_search_metaheuristic(localSearchMetaheuristic);
+  }
+  if (deterministic) {
+    routing->solver()->ReSeed(deterministicSeed);
+    parameters.clear_time_limit();
+    parameters.set_solution_limit(deterministicSolutionLimit);
+    auto *operators = parameters.mutable_local_search_operators();
+    operators->set_use_path_lns(operations_research::BOOL_FALSE);
+    operators->set_use_full_path_lns(operations_research::BOOL_FALSE);
+    operators->set_use_tsp_lns(operations_research::BOOL_FALSE);
+    operators->set_use_inactive_lns(operations_research::BOOL_FALSE);
+  }
+  if (!trajectoryCallbackAdded) {
+    routing->AddAtSolutionCallback([this]() {
+      if (!solveInProgress) {
+        return;
+      }
+      const int64_t objective = routing->CostVar()->Value();
+      if (objectiveTrajectory.empty() || objective < bestObjective) {
+        bestObjective = objective;
+      }
+      objectiveTrajectory.push_back(objective);
+    });
+    trajectoryCallbackAdded = true;
+  }
+  objectiveTrajectory.clear();
+  if (earlyStopGap > 0) {
+    earlyStopBound = ComputeLowerBound(earlyStopThreads).objective;
+    if (!earlyStopLimitAdded) {
+      // Monitors stay on the model and also run when ReadAssignmentFromRoutes
+      // restores routes, so the limit only applies inside this function.
+      routing->AddSearchMonitor(routing->solver()->MakeCustomLimit([this]() {
+        return solveInProgress && earlyStopGap > 0 &&
+               !objectiveTrajectory.empty() &&
+               bestObjective - earlyStopBound <= earlyStopGap * bestObjective;
+      }));
+      earlyStopLimitAdded = true;
+    }
+  }
+
+  if (memoryBudget > 0 &&
+      (modelOverBudget || !FitMemoryBudget(&parameters))) {
+    solution = nullptr;
+    std::ostringstream entry;
+    entry << "rejected: estimated "
+          << EstimateMemoryFor(parameters).total_bytes
+          << " bytes exceed the memory budget of " << memoryBudget
+          << " bytes\n";
+    replayLog += entry.str();
+    return false;
+  }
+  // Locks need a closed model; closing it with the parameters of this solve
+  // builds the same search the solve would.
+  if (!routeLocks.empty()) {
+    routing->CloseModelWithParameters(parameters);
+    if (!routing->ApplyLocksToAllVehicles(routeLocks, false)) {
+      solution = nullptr;
+      replayLog += "rejected: route locks do not fit the model\n";
+      return false;
+    }
+  }
+  solveInProgress = true;
+  solution = routing->SolveWithParameters(parameters);
+  solveInProgress = false;
+
+  std::ostringstream entry;
+  entry << "deterministic: " << deterministic << "\n";
+  if (deterministic) {
+    entry << "seed: " << deterministicSeed << "\n";
+  }
+  entry << "parameters: " << parameters.ShortDebugString() << "\n";
+  if (earlyStopGap > 0) {
+    entry << "lower bound: " << earlyStopBound << "\n";
+  }
+  entry << "objectives:";
+  for (int64_t objective : objectiveTrajectory) {
+    entry << " " << objective;
+  }
+  entry << "\nstatus: " << routing->status() << "\n";
+  replayLog += entry.str();
+  return solution != nullptr;
+}
+
+std::vector<std::vector<int64_t>> RoutingWrapper::ExtractRoutes() const {
+  std::vector<std::vector<int64_t>> routes(data.num_vehicles);
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    int64_t index = routing->Start(vehicle);
+    while (!routing->IsEnd(index)) {
+      routes[vehicle].push_back(manager->IndexToNode(index).value());
+      index = solution->Value(routing->NextVar(index));
+    }
+    routes[vehicle].push_back(manager->IndexToNode(index).value());
+  }
+  return routes;
+}
+
+std::vector<int64_t> RoutingWrapper::GetRoute(int vehicle) {
+  if (solution == nullptr || vehicle < 0 || vehicle >= data.num_vehicles) {
+    return {};
+  }
+  std::vector<int64_t> route;
+  for (int64_t node : ExtractRoutes()[vehicle]) {
+    AppendOriginalNodes(node, &route);
+  }
+  return route;
+}
+
+bool RoutingWrapper::ImproveRoutesAfterSolve(int num_neighbors,
+                                             int num_threads) {
+  if (num_neighbors < 1 || solution == nullptr ||
+      data.distance_oracle != nullptr) {
+    return false;
+  }
+  const std::vector<std::vector<int64_t>> routes = ExtractRoutes();
+  std::vector<std::vector<int64_t>> improved_routes = routes;
+  if (!ImproveRoutes(data.flat_distance_matrix, num_neighbors, num_threads,
+                     &improved_routes)) {
+    return false;
+  }
+  return ReplaceRoutesIfBetter(routes, improved_routes);
+}
+
+bool RoutingWrapper::ImproveWithRuinAndRecreate(int iterations,
+                                                int num_threads,
+                                                int32_t seed) {
+  RuinRecreateOptions options;
+  options.iterations = iterations;
+  options.num_threads = num_threads;
+  options.seed = seed;
+  return RunRuinAndRecreate(options);
+}
+
+bool RoutingWrapper::RunRuinAndRecreate(const RuinRecreateOptions &options) {
+  if (solution == nullptr || data.distance_oracle != nullptr) {
+    return false;
+  }
+  const std::vector<std::vector<int64_t>> routes = ExtractRoutes();
+  std::vector<std::vector<int64_t>> improved_routes = routes;
+  if (!RuinAndRecreate(data.flat_distance_matrix, data.demands,
+                       data.demands.empty() ? std::vector<int64_t>()
+                                            : data.vehicle_capacities,
+                       options, &improved_routes)) {
+    return false;
+  }
+  return ReplaceRoutesIfBetter(routes, improved_routes);
+}
+
+bool RoutingWrapper::ReplaceRoutesIfBetter(
+    const std::vector<std::vector<int64_t>> &routes,
+    const std::vector<std::vector<int64_t>> &improved_routes) {
+  // ReadAssignmentFromRoutes expects routing indices without starts and ends.
+  auto to_indices = [this](const std::vector<std::vector<int64_t>> &routes) {
+    std::vector<std::vector<int64_t>> indices(routes.size());
+    for (size_t vehicle = 0; vehicle < routes.size(); ++vehicle) {
+      for (size_t i = 1; i + 1 < routes[vehicle].size(); ++i) {
+        indices[vehicle].push_back(manager->NodeToIndex(
+            operations_research::RoutingIndexManager::NodeIndex(
+                routes[vehicle][i])));
+      }
+    }
+    return indices;
+  };
+  // The model validates the new routes against every dimension; the result
+  // is only kept if its objective, which also covers non-distance costs, is
+  // lower.
+  const int64_t objective = solution->ObjectiveValue();
+  const operations_research::Assignment *improved =
+      routing->ReadAssignmentFromRoutes(to_indices(improved_routes), true);
+  if (improved != nullptr && improved->ObjectiveValue() < objective) {
+    solution = improved;
+    return true;
+  }
+  // Reading routes resets the assignment solution points to, so it must be
+  // restored; should that fail there is no valid solution left.
+  solution = routing->ReadAssignmentFromRoutes(to_indices(routes), true);
+  return false;
+}
+
+bool RoutingWrapper::SetNodeCoordinates(std::vector<double> longitudes,
+                                        std::vector<double> latitudes) {
+  const size_t num_nodes = NumOriginalNodes();
+  if (longitudes.size() != num_nodes || latitudes.size() != num_nodes) {
+    return false;
+  }
+  for (size_t node = 0; node < num_nodes; ++node) {
+    if (!std::isfinite(longitudes[node]) || !std::isfinite(latitudes[node])) {
+      return false;
+    }
+  }
+  data.node_longitudes = std::move(longitudes);
+  data.node_latitudes = std::move(latitudes);
+  return true;
+}
+
+bool RoutingWrapper::HasCoordinates() const {
+  return data.node_longitudes.size() ==
+         static_cast<size_t>(NumOriginalNodes());
+}
+
+int64_t RoutingWrapper::ExportSolution(const std::string &dimension_name,
+                                       RouteExporter *exporter,
+                                       ExportSink *sink) const {
+  if (solution == nullptr ||
+      (!dimension_name.empty() && !routing->HasDimension(dimension_name))) {
+    return -1;
+  }
+  const operations_research::RoutingDimension *dimension =
+      dimension_name.empty() ? nullptr
+                             : &routing->GetDimensionOrDie(dimension_name);
+  std::vector<int64_t> nodes;
+  std::vector<int64_t> cumuls;
+  exporter->Begin(solution->ObjectiveValue(), data.num_vehicles,
+                  dimension != nullptr);
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    nodes.clear();
+    cumuls.clear();
+    for (int64_t index = routing->Start(vehicle);;
+         index = solution->Value(routing->NextVar(index))) {
+      AppendOriginalNodes(manager->IndexToNode(index).value(), &nodes);
+      if (dimension != nullptr) {
+        cumuls.resize(nodes.size(),
+                      solution->Min(dimension->CumulVar(index)));
+      }
+      if (routing->IsEnd(index)) {
+        break;
+      }
+    }
+    exporter->Route(vehicle, nodes, cumuls);
+  }
+  exporter->End();
+  return sink->Finish() ? sink->size() : -1;
+}
+
+int64_t RoutingWrapper::ExportBinaryToBuffer(
+    char *buffer, int64_t capacity, const std::string &dimension_name) {
+  ExportSink sink(buffer, capacity);
+  BinaryRouteExporter exporter(&sink);
+  return ExportSolution(dimension_name, &exporter, &sink);
+}
+
+int64_t RoutingWrapper::ExportBinaryToFd(int fd,
+                                         const std::string &dimension_name) {
+  ExportSink sink(fd);
+  BinaryRouteExporter exporter(&sink);
+  return ExportSolution(dimension_name, &exporter, &sink);
+}
+
+int64_t RoutingWrapper::ExportGeoJsonToBuffer(
+    char *buffer, int64_t capacity, const std::string &dimension_name) {
+  if (!HasCoordinates()) {
+    return -1;
+  }
+  ExportSink sink(buffer, capacity);
+  GeoJsonRouteExporter exporter(&sink, data.node_longitudes,
+                                data.node_latitudes);
+  return ExportSolution(dimension_name, &exporter, &sink);
+}
+
+int64_t RoutingWrapper::ExportGeoJsonToFd(int fd,
+                                          const std::string &dimension_name) {
+  if (!HasCoordinates()) {
+    return -1;
+  }
+  ExportSink sink(fd);
+  GeoJsonRouteExporter exporter(&sink, data.node_longitudes,
+                                data.node_latitudes);
+  return ExportSolution(dimension_name, &exporter, &sink);
+}
+
+int64_t RoutingWrapper::VisitIndex(int64_t node) const {
+  if (node < 0 || node >= data.num_nodes()) {
+    return operations_research::RoutingIndexManager::kUnassigned;
+  }
+  const int64_t index = manager->NodeToIndex(
+      operations_research::RoutingIndexManager::NodeIndex(node));
+  if (index == operations_research::RoutingIndexManager::kUnassigned ||
+      routing->IsStart(index) || routing->IsEnd(index)) {
+    return operations_research::RoutingIndexManager::kUnassigned;
+  }
+  return index;
+}
+
+void RoutingWrapper::PrintSolution() {
+  if (solution == nullptr) {
+    std::cout << "No solution found." << std::endl;
+    return;
+  }
+  int64_t total_distance = 0;
+  const std::vector<std::vector<int64_t>> routes = ExtractRoutes();
+  for (int vehicle = 0; vehicle < data.num_vehicles; ++vehicle) {
+    const std::vector<int64_t> &route = routes[vehicle];
+    int64_t route_distance = 0;
+    std::ostringstream route_text;
+    std::vector<int64_t> original_nodes;
+    for (size_t i = 0; i < route.size(); ++i) {
+      if (i > 0) {
+        route_distance += data.Distance(route[i - 1], route[i]);
+      }
+      AppendOriginalNodes(route[i], &original_nodes);
+    }
+    for (size_t i = 0; i < original_nodes.size(); ++i) {
+      if (i > 0) {
+        route_text << " -> ";
+      }
+      route_text << original_nodes[i];
+    }
+    std::cout << "Route for Vehicle " << vehicle << ":" << std::endl;
+    std::cout << route_text.str() << std::endl;
+    std::cout << "Distance of the route: " << route_distance << "m"
+              << std::endl;
+    total_distance += route_distance;
+  }
+  std::cout << "Total Distance of all routes: " << total_distance << "m"
+            << std::endl;
+  const std::vector<int64_t> dropped = GetDroppedNodes();
+  if (!dropped.empty()) {
+    std::cout << "Dropped nodes:";
+    for (int64_t node : dropped) {
+      std::cout << " " << node;
+    }
+    std::cout << std::endl;
+  }
+  std::cout << "Objective: " << solution->ObjectiveValue() << std::endl;
+}
+} // namespace constraint_solver
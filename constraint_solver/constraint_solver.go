@@ -27,52 +27,141 @@ typedef struct { char *p; intgo n; } _gostring_;
 typedef struct { void* array; intgo len; intgo cap; } _goslice_;
 
 
-typedef _gostring_ swig_type_1;
-typedef _gostring_ swig_type_2;
-typedef _gostring_ swig_type_3;
+typedef long long swig_type_1;
+typedef long long swig_type_2;
+typedef long long swig_type_3;
 typedef long long swig_type_4;
 typedef long long swig_type_5;
 typedef long long swig_type_6;
 typedef long long swig_type_7;
 typedef long long swig_type_8;
-typedef long long swig_type_9;
-typedef long long swig_type_10;
-typedef long long swig_type_11;
+typedef _gostring_ swig_type_9;
+typedef _gostring_ swig_type_10;
+typedef _gostring_ swig_type_11;
+typedef _gostring_ swig_type_12;
+typedef long long swig_type_13;
+typedef long long swig_type_14;
+typedef long long swig_type_15;
+typedef long long swig_type_16;
+typedef long long swig_type_17;
+typedef long long swig_type_18;
+typedef long long swig_type_19;
+typedef long long swig_type_20;
+typedef long long swig_type_21;
+typedef long long swig_type_22;
+typedef long long swig_type_23;
+typedef long long swig_type_24;
+typedef long long swig_type_25;
+typedef long long swig_type_26;
+typedef _gostring_ swig_type_27;
+typedef _goslice_ swig_type_28;
+typedef _goslice_ swig_type_29;
+typedef _gostring_ swig_type_30;
+typedef _goslice_ swig_type_31;
+typedef _gostring_ swig_type_32;
+typedef _goslice_ swig_type_33;
+typedef _goslice_ swig_type_34;
+typedef _goslice_ swig_type_35;
+typedef _goslice_ swig_type_36;
+typedef _goslice_ swig_type_37;
+typedef _goslice_ swig_type_38;
+typedef _goslice_ swig_type_39;
+typedef _goslice_ swig_type_40;
+typedef _goslice_ swig_type_41;
+typedef _gostring_ swig_type_42;
+typedef _goslice_ swig_type_43;
+typedef long long swig_type_44;
+typedef long long swig_type_45;
+typedef _gostring_ swig_type_46;
+typedef _goslice_ swig_type_47;
+typedef long long swig_type_48;
+typedef long long swig_type_49;
+typedef _gostring_ swig_type_50;
+typedef _goslice_ swig_type_51;
+typedef _goslice_ swig_type_52;
+typedef _goslice_ swig_type_53;
+typedef _goslice_ swig_type_54;
+typedef long long swig_type_55;
+typedef long long swig_type_56;
+typedef _gostring_ swig_type_57;
+typedef _gostring_ swig_type_58;
+typedef long long swig_type_59;
+typedef _goslice_ swig_type_60;
+typedef _gostring_ swig_type_61;
+typedef _gostring_ swig_type_62;
+typedef long long swig_type_63;
+typedef _gostring_ swig_type_64;
+typedef _goslice_ swig_type_65;
+typedef _gostring_ swig_type_66;
+typedef _goslice_ swig_type_67;
+typedef _goslice_ swig_type_68;
+typedef _goslice_ swig_type_69;
+typedef _gostring_ swig_type_70;
+typedef _goslice_ swig_type_71;
+typedef _goslice_ swig_type_72;
+typedef _goslice_ swig_type_73;
+typedef _goslice_ swig_type_74;
+typedef _gostring_ swig_type_75;
+typedef _goslice_ swig_type_76;
+typedef _goslice_ swig_type_77;
+typedef _goslice_ swig_type_78;
+typedef _goslice_ swig_type_79;
+typedef _goslice_ swig_type_80;
+typedef _goslice_ swig_type_81;
+typedef _goslice_ swig_type_82;
+typedef _gostring_ swig_type_83;
+typedef _gostring_ swig_type_84;
+typedef long long swig_type_85;
+typedef _gostring_ swig_type_86;
+typedef long long swig_type_87;
+typedef long long swig_type_88;
+typedef long long swig_type_89;
+typedef long long swig_type_90;
+typedef _gostring_ swig_type_91;
+typedef long long swig_type_92;
+typedef _goslice_ swig_type_93;
+typedef _goslice_ swig_type_94;
+typedef _goslice_ swig_type_95;
+typedef _goslice_ swig_type_96;
+typedef long long swig_type_97;
+typedef _goslice_ swig_type_98;
+typedef _gostring_ swig_type_99;
+typedef long long swig_type_100;
+typedef _gostring_ swig_type_101;
+typedef long long swig_type_102;
+typedef _goslice_ swig_type_103;
+typedef _gostring_ swig_type_104;
+typedef long long swig_type_105;
+typedef _gostring_ swig_type_106;
+typedef long long swig_type_107;
+typedef long long swig_type_108;
+typedef _gostring_ swig_type_109;
+typedef _gostring_ swig_type_110;
+typedef _gostring_ swig_type_111;
+typedef _gostring_ swig_type_112;
+typedef long long swig_type_113;
+typedef long long swig_type_114;
+typedef _goslice_ swig_type_115;
+typedef _goslice_ swig_type_116;
+typedef _goslice_ swig_type_117;
+typedef long long swig_type_118;
+typedef _goslice_ swig_type_119;
+typedef _goslice_ swig_type_120;
+typedef long long swig_type_121;
+typedef long long swig_type_122;
+typedef long long swig_type_123;
 
 #cgo LDFLAGS: -L../lib -lortools
 #cgo CPPFLAGS: -I../include
 
 extern void _wrap_Swig_free_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern uintptr_t _wrap_Swig_malloc_constraint_solver_095582e9481db22a(swig_intgo arg1);
-extern void _wrap_DataModel_distance_matrix_set_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
-extern uintptr_t _wrap_DataModel_distance_matrix_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_DataModel_num_vehicles_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
-extern swig_intgo _wrap_DataModel_num_vehicles_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_DataModel_depot_set_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
-extern uintptr_t _wrap_DataModel_depot_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_DataModel_vehicle_capacities_set_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
-extern uintptr_t _wrap_DataModel_vehicle_capacities_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern uintptr_t _wrap_new_DataModel_constraint_solver_095582e9481db22a(void);
-extern void _wrap_delete_DataModel_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern uintptr_t _wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a(void);
-extern void _wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2, swig_intgo arg3, swig_intgo arg4);
-extern uintptr_t _wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
-extern void _wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern swig_intgo _wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern _Bool _wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3, swig_intgo arg4, _Bool arg5, swig_type_1 arg6);
-extern _Bool _wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, uintptr_t arg3, uintptr_t arg4, _Bool arg5, swig_type_2 arg6);
-extern void _wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_3 arg2);
-extern void _wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_RoutingWrapper_PrintSolution_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_delete_RoutingWrapper_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern uintptr_t _wrap_new_DoubleVector__SWIG_0_constraint_solver_095582e9481db22a(void);
-extern uintptr_t _wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(swig_type_4 arg1);
+extern uintptr_t _wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(swig_type_1 arg1);
 extern uintptr_t _wrap_new_DoubleVector__SWIG_2_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern swig_type_5 _wrap_DoubleVector_size_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern swig_type_6 _wrap_DoubleVector_capacity_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_7 arg2);
+extern swig_type_2 _wrap_DoubleVector_size_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_3 _wrap_DoubleVector_capacity_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_4 arg2);
 extern _Bool _wrap_DoubleVector_isEmpty_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern void _wrap_DoubleVector_clear_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern void _wrap_DoubleVector_add_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
@@ -80,17 +169,163 @@ extern double _wrap_DoubleVector_get_constraint_solver_095582e9481db22a(uintptr_
 extern void _wrap_DoubleVector_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, double arg3);
 extern void _wrap_delete_DoubleVector_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern uintptr_t _wrap_new_DistanceMatrix__SWIG_0_constraint_solver_095582e9481db22a(void);
-extern uintptr_t _wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(swig_type_8 arg1);
+extern uintptr_t _wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(swig_type_5 arg1);
 extern uintptr_t _wrap_new_DistanceMatrix__SWIG_2_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern swig_type_9 _wrap_DistanceMatrix_size_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern swig_type_10 _wrap_DistanceMatrix_capacity_constraint_solver_095582e9481db22a(uintptr_t arg1);
-extern void _wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_11 arg2);
+extern swig_type_6 _wrap_DistanceMatrix_size_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_7 _wrap_DistanceMatrix_capacity_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_8 arg2);
 extern _Bool _wrap_DistanceMatrix_isEmpty_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern void _wrap_DistanceMatrix_clear_constraint_solver_095582e9481db22a(uintptr_t arg1);
 extern void _wrap_DistanceMatrix_add_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
 extern uintptr_t _wrap_DistanceMatrix_get_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
 extern void _wrap_DistanceMatrix_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, uintptr_t arg3);
 extern void _wrap_delete_DistanceMatrix_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_InstanceFeatures_num_nodes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_InstanceFeatures_num_nodes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_InstanceFeatures_num_vehicles_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_InstanceFeatures_num_vehicles_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_InstanceFeatures_capacity_tightness_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_InstanceFeatures_capacity_tightness_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_InstanceFeatures_clustering_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_InstanceFeatures_clustering_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_InstanceFeatures_asymmetry_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_InstanceFeatures_asymmetry_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_InstanceFeatures_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_InstanceFeatures_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_min_nodes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_SearchRule_min_nodes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_max_nodes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_SearchRule_max_nodes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_min_tightness_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_min_tightness_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_max_tightness_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_max_tightness_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_min_clustering_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_min_clustering_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_max_clustering_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_max_clustering_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_min_asymmetry_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_min_asymmetry_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_max_asymmetry_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_max_asymmetry_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_first_solution_strategy_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_9 arg2);
+extern swig_type_10 _wrap_SearchRule_first_solution_strategy_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_metaheuristic_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_11 arg2);
+extern swig_type_12 _wrap_SearchRule_metaheuristic_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_SearchRule_search_time_fraction_set_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2);
+extern double _wrap_SearchRule_search_time_fraction_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_SearchRule_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_SearchRule_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_13 _wrap_DataModel_ServiceTime_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_type_14 _wrap_DataModel_Distance_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3);
+extern uintptr_t _wrap_new_DataModel_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_DataModel_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_MemoryEstimate_matrix_bytes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_15 arg2);
+extern swig_type_16 _wrap_MemoryEstimate_matrix_bytes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_MemoryEstimate_index_manager_bytes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_17 arg2);
+extern swig_type_18 _wrap_MemoryEstimate_index_manager_bytes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_MemoryEstimate_model_bytes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_19 arg2);
+extern swig_type_20 _wrap_MemoryEstimate_model_bytes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_MemoryEstimate_search_bytes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_21 arg2);
+extern swig_type_22 _wrap_MemoryEstimate_search_bytes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_MemoryEstimate_total_bytes_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_23 arg2);
+extern swig_type_24 _wrap_MemoryEstimate_total_bytes_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_MemoryEstimate_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_MemoryEstimate_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_LowerBound_objective_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_25 arg2);
+extern swig_type_26 _wrap_LowerBound_objective_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_LowerBound_min_vehicles_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_LowerBound_min_vehicles_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_LowerBound_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_LowerBound_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_27 _wrap_SolveBuffer_constraint_solver_095582e9481db22a(swig_type_28 arg1);
+extern uintptr_t _wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a(void);
+extern void _wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2, swig_intgo arg3, swig_intgo arg4);
+extern _Bool _wrap_RoutingWrapper_InitFlatDataModel_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_29 arg2, swig_intgo arg3, swig_intgo arg4, swig_intgo arg5);
+extern _Bool _wrap_RoutingWrapper_InitRoadGraphDataModel_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_30 arg2, swig_type_31 arg3, swig_intgo arg4, swig_intgo arg5, swig_intgo arg6);
+extern _Bool _wrap_RoutingWrapper_InitRoadGraphMatrixDataModel_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_32 arg2, swig_type_33 arg3, swig_intgo arg4, swig_intgo arg5, swig_intgo arg6);
+extern _Bool _wrap_RoutingWrapper_SetVehicleStartsAndEnds_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_34 arg2, swig_type_35 arg3);
+extern uintptr_t _wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_SetVehicleClasses_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_36 arg2, swig_type_37 arg3, swig_type_38 arg4, swig_type_39 arg5);
+extern void _wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(uintptr_t arg1, uintptr_t arg2);
+extern void _wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RoutingWrapper_CreateRoutingModelFromData_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_intgo _wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_SetDemands_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_40 arg2, swig_type_41 arg3);
+extern _Bool _wrap_RoutingWrapper_AddCapacityDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_42 arg2);
+extern _Bool _wrap_RoutingWrapper_SetServiceTimes_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_43 arg2);
+extern _Bool _wrap_RoutingWrapper_AddTimeDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_44 arg2, swig_type_45 arg3, _Bool arg4, swig_type_46 arg5);
+extern swig_intgo _wrap_RoutingWrapper_AggregateColocatedStops_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_47 _wrap_RoutingWrapper_GetNodeGroups_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_AddVehicleClassTimeDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_48 arg2, swig_type_49 arg3, _Bool arg4, swig_type_50 arg5);
+extern swig_intgo _wrap_RoutingWrapper_AddTravelTimeProfile_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_51 arg2, swig_type_52 arg3);
+extern _Bool _wrap_RoutingWrapper_SetTravelTimeZones_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_53 arg2, swig_type_54 arg3);
+extern _Bool _wrap_RoutingWrapper_AddTimeDependentDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_55 arg2, swig_type_56 arg3, _Bool arg4, swig_type_57 arg5);
+extern _Bool _wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3, swig_intgo arg4, _Bool arg5, swig_type_58 arg6);
+extern _Bool _wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_type_59 arg3, swig_type_60 arg4, _Bool arg5, swig_type_61 arg6);
+extern _Bool _wrap_RoutingWrapper_SetGlobalSpanCostCoefficient_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_62 arg2, swig_type_63 arg3);
+extern _Bool _wrap_RoutingWrapper_SetSpanUpperBounds_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_64 arg2, swig_type_65 arg3);
+extern _Bool _wrap_RoutingWrapper_SetCumulSoftUpperBounds_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_66 arg2, swig_type_67 arg3, swig_type_68 arg4, swig_type_69 arg5);
+extern _Bool _wrap_RoutingWrapper_SetRouteEndSoftUpperBounds_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_70 arg2, swig_type_71 arg3, swig_type_72 arg4);
+extern _Bool _wrap_RoutingWrapper_AddPickupsAndDeliveries_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_73 arg2, swig_type_74 arg3, swig_type_75 arg4);
+extern _Bool _wrap_RoutingWrapper_SetDropPenalties_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_76 arg2);
+extern _Bool _wrap_RoutingWrapper_AddDisjunctionGroups_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_77 arg2, swig_type_78 arg3, swig_type_79 arg4, swig_type_80 arg5);
+extern _Bool _wrap_RoutingWrapper_ApplyRouteLocks_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_81 arg2, swig_type_82 arg3);
+extern void _wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_83 arg2);
+extern void _wrap_RoutingWrapper_SetLocalSearchMetaheuristic_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_84 arg2);
+extern void _wrap_RoutingWrapper_SetTimeLimit_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_85 arg2);
+extern uintptr_t _wrap_RoutingWrapper_GetInstanceFeatures_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_LoadSearchRules_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_86 arg2);
+extern uintptr_t _wrap_RoutingWrapper_GetSearchRule_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_RoutingWrapper_AutoConfigure_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_87 arg2);
+extern _Bool _wrap_RoutingWrapper_SolveAutoConfigured_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_88 arg2, swig_intgo arg3);
+extern _Bool _wrap_RoutingWrapper_SetDeterministicMode_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_type_89 arg3);
+extern void _wrap_RoutingWrapper_SetMemoryBudget_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_90 arg2, _Bool arg3);
+extern uintptr_t _wrap_RoutingWrapper_EstimateMemory_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_RoutingWrapper_ComputeLowerBound_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern void _wrap_RoutingWrapper_SetEarlyStopGap_constraint_solver_095582e9481db22a(uintptr_t arg1, double arg2, swig_intgo arg3);
+extern _Bool _wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_91 _wrap_RoutingWrapper_GetReplayLog_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_HasSolution_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_92 _wrap_RoutingWrapper_GetObjectiveValue_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_93 _wrap_RoutingWrapper_GetRoute_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_type_94 _wrap_RoutingWrapper_GetDroppedNodes_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RoutingWrapper_ImproveRoutesAfterSolve_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3);
+extern _Bool _wrap_RoutingWrapper_ImproveWithRuinAndRecreate_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3, swig_intgo arg4);
+extern _Bool _wrap_RoutingWrapper_SetNodeCoordinates_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_95 arg2, swig_type_96 arg3);
+extern swig_type_97 _wrap_RoutingWrapper_ExportBinaryToBuffer_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_98 arg2, swig_type_99 arg3);
+extern swig_type_100 _wrap_RoutingWrapper_ExportBinaryToFd_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_type_101 arg3);
+extern swig_type_102 _wrap_RoutingWrapper_ExportGeoJsonToBuffer_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_103 arg2, swig_type_104 arg3);
+extern swig_type_105 _wrap_RoutingWrapper_ExportGeoJsonToFd_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_type_106 arg3);
+extern void _wrap_RoutingWrapper_PrintSolution_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_delete_RoutingWrapper_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_max_batch_orders_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_RollingHorizonOptions_max_batch_orders_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_locked_visits_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_intgo _wrap_RollingHorizonOptions_locked_visits_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_time_limit_ms_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_107 arg2);
+extern swig_type_108 _wrap_RollingHorizonOptions_time_limit_ms_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_first_solution_strategy_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_109 arg2);
+extern swig_type_110 _wrap_RollingHorizonOptions_first_solution_strategy_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_metaheuristic_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_111 arg2);
+extern swig_type_112 _wrap_RollingHorizonOptions_metaheuristic_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_RollingHorizonOptions_drop_penalty_set_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_113 arg2);
+extern swig_type_114 _wrap_RollingHorizonOptions_drop_penalty_get_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_RollingHorizonOptions_constraint_solver_095582e9481db22a(void);
+extern void _wrap_delete_RollingHorizonOptions_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern uintptr_t _wrap_new_RollingHorizonPlanner_constraint_solver_095582e9481db22a(swig_type_115 arg1, swig_intgo arg2, swig_intgo arg3, swig_intgo arg4, uintptr_t arg5);
+extern _Bool _wrap_RollingHorizonPlanner_IsValid_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern _Bool _wrap_RollingHorizonPlanner_SetDemands_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_116 arg2, swig_type_117 arg3);
+extern _Bool _wrap_RollingHorizonPlanner_QueueOrder_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_type_118 arg2);
+extern _Bool _wrap_RollingHorizonPlanner_CommitVisits_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2, swig_intgo arg3);
+extern _Bool _wrap_RollingHorizonPlanner_ProcessBatch_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_119 _wrap_RollingHorizonPlanner_GetCommittedVisits_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_type_120 _wrap_RollingHorizonPlanner_GetOpenVisits_constraint_solver_095582e9481db22a(uintptr_t arg1, swig_intgo arg2);
+extern swig_type_121 _wrap_RollingHorizonPlanner_GetQueuedOrders_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_122 _wrap_RollingHorizonPlanner_GetLastModelSize_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern swig_type_123 _wrap_RollingHorizonPlanner_GetLastBatchMs_constraint_solver_095582e9481db22a(uintptr_t arg1);
+extern void _wrap_delete_RollingHorizonPlanner_constraint_solver_095582e9481db22a(uintptr_t arg1);
 #undef intgo
 */
 import "C"
@@ -145,212 +380,12 @@ func Swig_malloc(arg1 int) (_swig_ret uintptr) {
 	return swig_r
 }
 
-type SwigcptrDataModel uintptr
-
-func (p SwigcptrDataModel) Swigcptr() uintptr {
-	return (uintptr)(p)
-}
-
-func (p SwigcptrDataModel) SwigIsDataModel() {
-}
-
-func (arg1 SwigcptrDataModel) SetDistance_matrix(arg2 DistanceMatrix) {
-	_swig_i_0 := arg1
-	_swig_i_1 := getSwigcptr(arg2)
-	C._wrap_DataModel_distance_matrix_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1))
-}
-
-func (arg1 SwigcptrDataModel) GetDistance_matrix() (_swig_ret DistanceMatrix) {
-	var swig_r DistanceMatrix
-	_swig_i_0 := arg1
-	swig_r = (DistanceMatrix)(SwigcptrDistanceMatrix(C._wrap_DataModel_distance_matrix_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
-	return swig_r
-}
-
-func (arg1 SwigcptrDataModel) SetNum_vehicles(arg2 int) {
-	_swig_i_0 := arg1
-	_swig_i_1 := arg2
-	C._wrap_DataModel_num_vehicles_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
-}
-
-func (arg1 SwigcptrDataModel) GetNum_vehicles() (_swig_ret int) {
-	var swig_r int
-	_swig_i_0 := arg1
-	swig_r = (int)(C._wrap_DataModel_num_vehicles_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
-	return swig_r
-}
-
-func (arg1 SwigcptrDataModel) SetDepot(arg2 Operations_research_RoutingIndexManager_NodeIndex) {
-	_swig_i_0 := arg1
-	_swig_i_1 := getSwigcptr(arg2)
-	C._wrap_DataModel_depot_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1))
-}
-
-func (arg1 SwigcptrDataModel) GetDepot() (_swig_ret Operations_research_RoutingIndexManager_NodeIndex) {
-	var swig_r Operations_research_RoutingIndexManager_NodeIndex
-	_swig_i_0 := arg1
-	swig_r = (Operations_research_RoutingIndexManager_NodeIndex)(SwigcptrOperations_research_RoutingIndexManager_NodeIndex(C._wrap_DataModel_depot_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
-	return swig_r
-}
-
-func (arg1 SwigcptrDataModel) SetVehicle_capacities(arg2 Std_vector_Sl_int64_t_Sg_) {
-	_swig_i_0 := arg1
-	_swig_i_1 := getSwigcptr(arg2)
-	C._wrap_DataModel_vehicle_capacities_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1))
-}
-
-func (arg1 SwigcptrDataModel) GetVehicle_capacities() (_swig_ret Std_vector_Sl_int64_t_Sg_) {
-	var swig_r Std_vector_Sl_int64_t_Sg_
-	_swig_i_0 := arg1
-	swig_r = (Std_vector_Sl_int64_t_Sg_)(SwigcptrStd_vector_Sl_int64_t_Sg_(C._wrap_DataModel_vehicle_capacities_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
-	return swig_r
-}
-
-func NewDataModel() (_swig_ret DataModel) {
-	var swig_r DataModel
-	swig_r = (DataModel)(SwigcptrDataModel(C._wrap_new_DataModel_constraint_solver_095582e9481db22a()))
-	return swig_r
-}
-
-func DeleteDataModel(arg1 DataModel) {
-	_swig_i_0 := getSwigcptr(arg1)
-	C._wrap_delete_DataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-type DataModel interface {
-	Swigcptr() uintptr
-	SwigIsDataModel()
-	SetDistance_matrix(arg2 DistanceMatrix)
-	GetDistance_matrix() (_swig_ret DistanceMatrix)
-	SetNum_vehicles(arg2 int)
-	GetNum_vehicles() (_swig_ret int)
-	SetDepot(arg2 Operations_research_RoutingIndexManager_NodeIndex)
-	GetDepot() (_swig_ret Operations_research_RoutingIndexManager_NodeIndex)
-	SetVehicle_capacities(arg2 Std_vector_Sl_int64_t_Sg_)
-	GetVehicle_capacities() (_swig_ret Std_vector_Sl_int64_t_Sg_)
-}
-
-type SwigcptrRoutingWrapper uintptr
-
-func (p SwigcptrRoutingWrapper) Swigcptr() uintptr {
-	return (uintptr)(p)
-}
-
-func (p SwigcptrRoutingWrapper) SwigIsRoutingWrapper() {
-}
-
-func NewRoutingWrapper() (_swig_ret RoutingWrapper) {
-	var swig_r RoutingWrapper
-	swig_r = (RoutingWrapper)(SwigcptrRoutingWrapper(C._wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a()))
-	return swig_r
-}
-
-func (arg1 SwigcptrRoutingWrapper) InitDataModel(arg2 DistanceMatrix, arg3 int, arg4 int) {
-	_swig_i_0 := arg1
-	_swig_i_1 := getSwigcptr(arg2)
-	_swig_i_2 := arg3
-	_swig_i_3 := arg4
-	C._wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3))
-}
-
-func (arg1 SwigcptrRoutingWrapper) GetData() (_swig_ret DataModel) {
-	var swig_r DataModel
-	_swig_i_0 := arg1
-	swig_r = (DataModel)(SwigcptrDataModel(C._wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
-	return swig_r
-}
-
-func (arg1 SwigcptrRoutingWrapper) CreateRoutingIndexManager(arg2 DataModel) {
-	_swig_i_0 := arg1
-	_swig_i_1 := getSwigcptr(arg2)
-	C._wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1))
-}
-
-func (arg1 SwigcptrRoutingWrapper) CreateRoutingModel() {
-	_swig_i_0 := arg1
-	C._wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-func (arg1 SwigcptrRoutingWrapper) RegisterTransitCallback() (_swig_ret int) {
-	var swig_r int
-	_swig_i_0 := arg1
-	swig_r = (int)(C._wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
-	return swig_r
-}
-
-func (arg1 SwigcptrRoutingWrapper) AddDimension(arg2 int, arg3 int, arg4 int, arg5 bool, arg6 string) (_swig_ret bool) {
-	var swig_r bool
-	_swig_i_0 := arg1
-	_swig_i_1 := arg2
-	_swig_i_2 := arg3
-	_swig_i_3 := arg4
-	_swig_i_4 := arg5
-	_swig_i_5 := arg6
-	swig_r = (bool)(C._wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3), C._Bool(_swig_i_4), *(*C.swig_type_1)(unsafe.Pointer(&_swig_i_5))))
-	if Swig_escape_always_false {
-		Swig_escape_val = arg6
-	}
-	return swig_r
-}
-
-func (arg1 SwigcptrRoutingWrapper) AddDimensionWithVehicleCapacity(arg2 int, arg3 Int64_t, arg4 Std_vector_Sl_int64_t_Sg_, arg5 bool, arg6 string) (_swig_ret bool) {
-	var swig_r bool
-	_swig_i_0 := arg1
-	_swig_i_1 := arg2
-	_swig_i_2 := getSwigcptr(arg3)
-	_swig_i_3 := getSwigcptr(arg4)
-	_swig_i_4 := arg5
-	_swig_i_5 := arg6
-	swig_r = (bool)(C._wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.uintptr_t(_swig_i_2), C.uintptr_t(_swig_i_3), C._Bool(_swig_i_4), *(*C.swig_type_2)(unsafe.Pointer(&_swig_i_5))))
-	if Swig_escape_always_false {
-		Swig_escape_val = arg6
-	}
-	return swig_r
-}
-
-func (arg1 SwigcptrRoutingWrapper) CreateDefaultRoutingSearchParameters() {
-	_swig_i_0 := arg1
-	C._wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-func (arg1 SwigcptrRoutingWrapper) SetFirstSolutionStrategy(arg2 string) {
-	_swig_i_0 := arg1
-	_swig_i_1 := arg2
-	C._wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_3)(unsafe.Pointer(&_swig_i_1)))
-	if Swig_escape_always_false {
-		Swig_escape_val = arg2
-	}
-}
-
-func (arg1 SwigcptrRoutingWrapper) SolveWithCurrentParameters() {
-	_swig_i_0 := arg1
-	C._wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-func (arg1 SwigcptrRoutingWrapper) PrintSolution() {
-	_swig_i_0 := arg1
-	C._wrap_RoutingWrapper_PrintSolution_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-func DeleteRoutingWrapper(arg1 RoutingWrapper) {
-	_swig_i_0 := getSwigcptr(arg1)
-	C._wrap_delete_RoutingWrapper_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
-}
-
-type RoutingWrapper interface {
-	Swigcptr() uintptr
-	SwigIsRoutingWrapper()
-	InitDataModel(arg2 DistanceMatrix, arg3 int, arg4 int)
-	GetData() (_swig_ret DataModel)
-	CreateRoutingIndexManager(arg2 DataModel)
-	CreateRoutingModel()
-	RegisterTransitCallback() (_swig_ret int)
-	AddDimension(arg2 int, arg3 int, arg4 int, arg5 bool, arg6 string) (_swig_ret bool)
-	AddDimensionWithVehicleCapacity(arg2 int, arg3 Int64_t, arg4 Std_vector_Sl_int64_t_Sg_, arg5 bool, arg6 string) (_swig_ret bool)
-	CreateDefaultRoutingSearchParameters()
-	SetFirstSolutionStrategy(arg2 string)
-	SolveWithCurrentParameters()
-	PrintSolution()
+type swig_gostring struct { p uintptr; n int }
+func swigCopyString(s string) string {
+  p := *(*swig_gostring)(unsafe.Pointer(&s))
+  r := string((*[0x7fffffff]byte)(unsafe.Pointer(p.p))[:p.n])
+  Swig_free(p.p)
+  return r
 }
 
 type SwigcptrDoubleVector uintptr
@@ -371,7 +406,7 @@ func NewDoubleVector__SWIG_0() (_swig_ret DoubleVector) {
 func NewDoubleVector__SWIG_1(arg1 int64) (_swig_ret DoubleVector) {
 	var swig_r DoubleVector
 	_swig_i_0 := arg1
-	swig_r = (DoubleVector)(SwigcptrDoubleVector(C._wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(C.swig_type_4(_swig_i_0))))
+	swig_r = (DoubleVector)(SwigcptrDoubleVector(C._wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(C.swig_type_1(_swig_i_0))))
 	return swig_r
 }
 
@@ -417,7 +452,7 @@ func (arg1 SwigcptrDoubleVector) Capacity() (_swig_ret int64) {
 func (arg1 SwigcptrDoubleVector) Reserve(arg2 int64) {
 	_swig_i_0 := arg1
 	_swig_i_1 := arg2
-	C._wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_7(_swig_i_1))
+	C._wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_4(_swig_i_1))
 }
 
 func (arg1 SwigcptrDoubleVector) IsEmpty() (_swig_ret bool) {
@@ -489,7 +524,7 @@ func NewDistanceMatrix__SWIG_0() (_swig_ret DistanceMatrix) {
 func NewDistanceMatrix__SWIG_1(arg1 int64) (_swig_ret DistanceMatrix) {
 	var swig_r DistanceMatrix
 	_swig_i_0 := arg1
-	swig_r = (DistanceMatrix)(SwigcptrDistanceMatrix(C._wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(C.swig_type_8(_swig_i_0))))
+	swig_r = (DistanceMatrix)(SwigcptrDistanceMatrix(C._wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(C.swig_type_5(_swig_i_0))))
 	return swig_r
 }
 
@@ -535,7 +570,7 @@ func (arg1 SwigcptrDistanceMatrix) Capacity() (_swig_ret int64) {
 func (arg1 SwigcptrDistanceMatrix) Reserve(arg2 int64) {
 	_swig_i_0 := arg1
 	_swig_i_1 := arg2
-	C._wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_11(_swig_i_1))
+	C._wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_8(_swig_i_1))
 }
 
 func (arg1 SwigcptrDistanceMatrix) IsEmpty() (_swig_ret bool) {
@@ -589,28 +624,1558 @@ type DistanceMatrix interface {
 	Set(arg2 int, arg3 DoubleVector)
 }
 
+type SwigcptrInstanceFeatures uintptr
+
+func (p SwigcptrInstanceFeatures) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrInstanceFeatures) SwigIsInstanceFeatures() {
+}
+
+func (arg1 SwigcptrInstanceFeatures) SetNum_nodes(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_InstanceFeatures_num_nodes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrInstanceFeatures) GetNum_nodes() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_InstanceFeatures_num_nodes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrInstanceFeatures) SetNum_vehicles(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_InstanceFeatures_num_vehicles_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrInstanceFeatures) GetNum_vehicles() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_InstanceFeatures_num_vehicles_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrInstanceFeatures) SetCapacity_tightness(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_InstanceFeatures_capacity_tightness_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrInstanceFeatures) GetCapacity_tightness() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_InstanceFeatures_capacity_tightness_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrInstanceFeatures) SetClustering(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_InstanceFeatures_clustering_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrInstanceFeatures) GetClustering() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_InstanceFeatures_clustering_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrInstanceFeatures) SetAsymmetry(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_InstanceFeatures_asymmetry_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
 
-type SwigcptrInt64_t uintptr
-type Int64_t interface {
-	Swigcptr() uintptr;
+func (arg1 SwigcptrInstanceFeatures) GetAsymmetry() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_InstanceFeatures_asymmetry_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
 }
-func (p SwigcptrInt64_t) Swigcptr() uintptr {
-	return uintptr(p)
+
+func NewInstanceFeatures() (_swig_ret InstanceFeatures) {
+	var swig_r InstanceFeatures
+	swig_r = (InstanceFeatures)(SwigcptrInstanceFeatures(C._wrap_new_InstanceFeatures_constraint_solver_095582e9481db22a()))
+	return swig_r
 }
 
-type SwigcptrStd_vector_Sl_int64_t_Sg_ uintptr
-type Std_vector_Sl_int64_t_Sg_ interface {
-	Swigcptr() uintptr;
+func DeleteInstanceFeatures(arg1 InstanceFeatures) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_InstanceFeatures_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
 }
-func (p SwigcptrStd_vector_Sl_int64_t_Sg_) Swigcptr() uintptr {
-	return uintptr(p)
+
+type InstanceFeatures interface {
+	Swigcptr() uintptr
+	SwigIsInstanceFeatures()
+	SetNum_nodes(arg2 int)
+	GetNum_nodes() (_swig_ret int)
+	SetNum_vehicles(arg2 int)
+	GetNum_vehicles() (_swig_ret int)
+	SetCapacity_tightness(arg2 float64)
+	GetCapacity_tightness() (_swig_ret float64)
+	SetClustering(arg2 float64)
+	GetClustering() (_swig_ret float64)
+	SetAsymmetry(arg2 float64)
+	GetAsymmetry() (_swig_ret float64)
 }
 
-type SwigcptrOperations_research_RoutingIndexManager_NodeIndex uintptr
-type Operations_research_RoutingIndexManager_NodeIndex interface {
-	Swigcptr() uintptr;
+type SwigcptrSearchRule uintptr
+
+func (p SwigcptrSearchRule) Swigcptr() uintptr {
+	return (uintptr)(p)
 }
-func (p SwigcptrOperations_research_RoutingIndexManager_NodeIndex) Swigcptr() uintptr {
-	return uintptr(p)
+
+func (p SwigcptrSearchRule) SwigIsSearchRule() {
 }
 
+func (arg1 SwigcptrSearchRule) SetMin_nodes(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_min_nodes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMin_nodes() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_SearchRule_min_nodes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMax_nodes(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_max_nodes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMax_nodes() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_SearchRule_max_nodes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMin_tightness(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_min_tightness_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMin_tightness() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_min_tightness_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMax_tightness(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_max_tightness_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMax_tightness() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_max_tightness_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMin_clustering(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_min_clustering_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMin_clustering() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_min_clustering_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMax_clustering(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_max_clustering_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMax_clustering() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_max_clustering_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMin_asymmetry(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_min_asymmetry_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMin_asymmetry() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_min_asymmetry_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetMax_asymmetry(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_max_asymmetry_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetMax_asymmetry() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_max_asymmetry_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrSearchRule) SetFirst_solution_strategy(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_first_solution_strategy_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_9)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrSearchRule) GetFirst_solution_strategy() (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_SearchRule_first_solution_strategy_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+func (arg1 SwigcptrSearchRule) SetMetaheuristic(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_metaheuristic_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_11)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrSearchRule) GetMetaheuristic() (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_SearchRule_metaheuristic_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+func (arg1 SwigcptrSearchRule) SetSearch_time_fraction(arg2 float64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_SearchRule_search_time_fraction_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1))
+}
+
+func (arg1 SwigcptrSearchRule) GetSearch_time_fraction() (_swig_ret float64) {
+	var swig_r float64
+	_swig_i_0 := arg1
+	swig_r = (float64)(C._wrap_SearchRule_search_time_fraction_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func NewSearchRule() (_swig_ret SearchRule) {
+	var swig_r SearchRule
+	swig_r = (SearchRule)(SwigcptrSearchRule(C._wrap_new_SearchRule_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func DeleteSearchRule(arg1 SearchRule) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_SearchRule_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type SearchRule interface {
+	Swigcptr() uintptr
+	SwigIsSearchRule()
+	SetMin_nodes(arg2 int)
+	GetMin_nodes() (_swig_ret int)
+	SetMax_nodes(arg2 int)
+	GetMax_nodes() (_swig_ret int)
+	SetMin_tightness(arg2 float64)
+	GetMin_tightness() (_swig_ret float64)
+	SetMax_tightness(arg2 float64)
+	GetMax_tightness() (_swig_ret float64)
+	SetMin_clustering(arg2 float64)
+	GetMin_clustering() (_swig_ret float64)
+	SetMax_clustering(arg2 float64)
+	GetMax_clustering() (_swig_ret float64)
+	SetMin_asymmetry(arg2 float64)
+	GetMin_asymmetry() (_swig_ret float64)
+	SetMax_asymmetry(arg2 float64)
+	GetMax_asymmetry() (_swig_ret float64)
+	SetFirst_solution_strategy(arg2 string)
+	GetFirst_solution_strategy() (_swig_ret string)
+	SetMetaheuristic(arg2 string)
+	GetMetaheuristic() (_swig_ret string)
+	SetSearch_time_fraction(arg2 float64)
+	GetSearch_time_fraction() (_swig_ret float64)
+}
+
+type SwigcptrDataModel uintptr
+
+func (p SwigcptrDataModel) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrDataModel) SwigIsDataModel() {
+}
+
+func (arg1 SwigcptrDataModel) ServiceTime(arg2 int) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (int64)(C._wrap_DataModel_ServiceTime_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1)))
+	return swig_r
+}
+
+func (arg1 SwigcptrDataModel) Distance(arg2 int, arg3 int) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (int64)(C._wrap_DataModel_Distance_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2)))
+	return swig_r
+}
+
+func NewDataModel() (_swig_ret DataModel) {
+	var swig_r DataModel
+	swig_r = (DataModel)(SwigcptrDataModel(C._wrap_new_DataModel_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func DeleteDataModel(arg1 DataModel) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_DataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type DataModel interface {
+	Swigcptr() uintptr
+	SwigIsDataModel()
+	ServiceTime(arg2 int) (_swig_ret int64)
+	Distance(arg2 int, arg3 int) (_swig_ret int64)
+}
+
+type SwigcptrMemoryEstimate uintptr
+
+func (p SwigcptrMemoryEstimate) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrMemoryEstimate) SwigIsMemoryEstimate() {
+}
+
+func (arg1 SwigcptrMemoryEstimate) SetMatrix_bytes(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_MemoryEstimate_matrix_bytes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_15(_swig_i_1))
+}
+
+func (arg1 SwigcptrMemoryEstimate) GetMatrix_bytes() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_MemoryEstimate_matrix_bytes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrMemoryEstimate) SetIndex_manager_bytes(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_MemoryEstimate_index_manager_bytes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_17(_swig_i_1))
+}
+
+func (arg1 SwigcptrMemoryEstimate) GetIndex_manager_bytes() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_MemoryEstimate_index_manager_bytes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrMemoryEstimate) SetModel_bytes(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_MemoryEstimate_model_bytes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_19(_swig_i_1))
+}
+
+func (arg1 SwigcptrMemoryEstimate) GetModel_bytes() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_MemoryEstimate_model_bytes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrMemoryEstimate) SetSearch_bytes(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_MemoryEstimate_search_bytes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_21(_swig_i_1))
+}
+
+func (arg1 SwigcptrMemoryEstimate) GetSearch_bytes() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_MemoryEstimate_search_bytes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrMemoryEstimate) SetTotal_bytes(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_MemoryEstimate_total_bytes_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_23(_swig_i_1))
+}
+
+func (arg1 SwigcptrMemoryEstimate) GetTotal_bytes() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_MemoryEstimate_total_bytes_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func NewMemoryEstimate() (_swig_ret MemoryEstimate) {
+	var swig_r MemoryEstimate
+	swig_r = (MemoryEstimate)(SwigcptrMemoryEstimate(C._wrap_new_MemoryEstimate_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func DeleteMemoryEstimate(arg1 MemoryEstimate) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_MemoryEstimate_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type MemoryEstimate interface {
+	Swigcptr() uintptr
+	SwigIsMemoryEstimate()
+	SetMatrix_bytes(arg2 int64)
+	GetMatrix_bytes() (_swig_ret int64)
+	SetIndex_manager_bytes(arg2 int64)
+	GetIndex_manager_bytes() (_swig_ret int64)
+	SetModel_bytes(arg2 int64)
+	GetModel_bytes() (_swig_ret int64)
+	SetSearch_bytes(arg2 int64)
+	GetSearch_bytes() (_swig_ret int64)
+	SetTotal_bytes(arg2 int64)
+	GetTotal_bytes() (_swig_ret int64)
+}
+
+type SwigcptrLowerBound uintptr
+
+func (p SwigcptrLowerBound) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrLowerBound) SwigIsLowerBound() {
+}
+
+func (arg1 SwigcptrLowerBound) SetObjective(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_LowerBound_objective_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_25(_swig_i_1))
+}
+
+func (arg1 SwigcptrLowerBound) GetObjective() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_LowerBound_objective_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrLowerBound) SetMin_vehicles(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_LowerBound_min_vehicles_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrLowerBound) GetMin_vehicles() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_LowerBound_min_vehicles_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func NewLowerBound() (_swig_ret LowerBound) {
+	var swig_r LowerBound
+	swig_r = (LowerBound)(SwigcptrLowerBound(C._wrap_new_LowerBound_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func DeleteLowerBound(arg1 LowerBound) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_LowerBound_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type LowerBound interface {
+	Swigcptr() uintptr
+	SwigIsLowerBound()
+	SetObjective(arg2 int64)
+	GetObjective() (_swig_ret int64)
+	SetMin_vehicles(arg2 int)
+	GetMin_vehicles() (_swig_ret int)
+}
+
+func SolveBuffer(arg1 []byte) (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_SolveBuffer_constraint_solver_095582e9481db22a(*(*C.swig_type_28)(unsafe.Pointer(&_swig_i_0)))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg1
+	}
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+type SwigcptrRoutingWrapper uintptr
+
+func (p SwigcptrRoutingWrapper) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrRoutingWrapper) SwigIsRoutingWrapper() {
+}
+
+func NewRoutingWrapper() (_swig_ret RoutingWrapper) {
+	var swig_r RoutingWrapper
+	swig_r = (RoutingWrapper)(SwigcptrRoutingWrapper(C._wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) InitDataModel(arg2 DistanceMatrix, arg3 int, arg4 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := getSwigcptr(arg2)
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	C._wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3))
+}
+
+func (arg1 SwigcptrRoutingWrapper) InitFlatDataModel(arg2 []int64, arg3 int, arg4 int, arg5 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_InitFlatDataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_29)(unsafe.Pointer(&_swig_i_1)), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3), C.swig_intgo(_swig_i_4)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) InitRoadGraphDataModel(arg2 string, arg3 []int64, arg4 int, arg5 int, arg6 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	_swig_i_5 := arg6
+	swig_r = (bool)(C._wrap_RoutingWrapper_InitRoadGraphDataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_30)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_31)(unsafe.Pointer(&_swig_i_2)), C.swig_intgo(_swig_i_3), C.swig_intgo(_swig_i_4), C.swig_intgo(_swig_i_5)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) InitRoadGraphMatrixDataModel(arg2 string, arg3 []int64, arg4 int, arg5 int, arg6 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	_swig_i_5 := arg6
+	swig_r = (bool)(C._wrap_RoutingWrapper_InitRoadGraphMatrixDataModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_32)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_33)(unsafe.Pointer(&_swig_i_2)), C.swig_intgo(_swig_i_3), C.swig_intgo(_swig_i_4), C.swig_intgo(_swig_i_5)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetVehicleStartsAndEnds(arg2 []int64, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetVehicleStartsAndEnds_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_34)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_35)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetData() (_swig_ret DataModel) {
+	var swig_r DataModel
+	_swig_i_0 := arg1
+	swig_r = (DataModel)(SwigcptrDataModel(C._wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetVehicleClasses(arg2 []int64, arg3 []float64, arg4 []float64, arg5 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetVehicleClasses_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_36)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_37)(unsafe.Pointer(&_swig_i_2)), *(*C.swig_type_38)(unsafe.Pointer(&_swig_i_3)), *(*C.swig_type_39)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) CreateRoutingIndexManager(arg2 DataModel) {
+	_swig_i_0 := arg1
+	_swig_i_1 := getSwigcptr(arg2)
+	C._wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.uintptr_t(_swig_i_1))
+}
+
+func (arg1 SwigcptrRoutingWrapper) CreateRoutingModel() {
+	_swig_i_0 := arg1
+	C._wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+func (arg1 SwigcptrRoutingWrapper) CreateRoutingModelFromData() {
+	_swig_i_0 := arg1
+	C._wrap_RoutingWrapper_CreateRoutingModelFromData_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+func (arg1 SwigcptrRoutingWrapper) RegisterTransitCallback() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetDemands(arg2 []int64, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetDemands_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_40)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_41)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddCapacityDimension(arg2 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddCapacityDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_42)(unsafe.Pointer(&_swig_i_1))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetServiceTimes(arg2 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetServiceTimes_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_43)(unsafe.Pointer(&_swig_i_1))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddTimeDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddTimeDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_44(_swig_i_1), C.swig_type_45(_swig_i_2), C._Bool(_swig_i_3), *(*C.swig_type_46)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AggregateColocatedStops() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_RoutingWrapper_AggregateColocatedStops_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetNodeGroups() (_swig_ret []int64) {
+	var swig_r []int64
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_RoutingWrapper_GetNodeGroups_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*[]int64)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 []int64
+  swig_r_1 = make([]int64, len(swig_r))
+  copy(swig_r_1, swig_r)
+  if len(swig_r) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&swig_r[0])))
+  }
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddVehicleClassTimeDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddVehicleClassTimeDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_48(_swig_i_1), C.swig_type_49(_swig_i_2), C._Bool(_swig_i_3), *(*C.swig_type_50)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddTravelTimeProfile(arg2 []int64, arg3 []float64) (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (int)(C._wrap_RoutingWrapper_AddTravelTimeProfile_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_51)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_52)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetTravelTimeZones(arg2 []int64, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetTravelTimeZones_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_53)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_54)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddTimeDependentDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddTimeDependentDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_55(_swig_i_1), C.swig_type_56(_swig_i_2), C._Bool(_swig_i_3), *(*C.swig_type_57)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddDimension(arg2 int, arg3 int, arg4 int, arg5 bool, arg6 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	_swig_i_5 := arg6
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3), C._Bool(_swig_i_4), *(*C.swig_type_58)(unsafe.Pointer(&_swig_i_5))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg6
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddDimensionWithVehicleCapacity(arg2 int, arg3 int64, arg4 []int64, arg5 bool, arg6 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	_swig_i_5 := arg6
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_type_59(_swig_i_2), *(*C.swig_type_60)(unsafe.Pointer(&_swig_i_3)), C._Bool(_swig_i_4), *(*C.swig_type_61)(unsafe.Pointer(&_swig_i_5))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg6
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetGlobalSpanCostCoefficient(arg2 string, arg3 int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetGlobalSpanCostCoefficient_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_62)(unsafe.Pointer(&_swig_i_1)), C.swig_type_63(_swig_i_2)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetSpanUpperBounds(arg2 string, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetSpanUpperBounds_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_64)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_65)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetCumulSoftUpperBounds(arg2 string, arg3 []int64, arg4 []int64, arg5 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetCumulSoftUpperBounds_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_66)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_67)(unsafe.Pointer(&_swig_i_2)), *(*C.swig_type_68)(unsafe.Pointer(&_swig_i_3)), *(*C.swig_type_69)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetRouteEndSoftUpperBounds(arg2 string, arg3 []int64, arg4 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetRouteEndSoftUpperBounds_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_70)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_71)(unsafe.Pointer(&_swig_i_2)), *(*C.swig_type_72)(unsafe.Pointer(&_swig_i_3))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddPickupsAndDeliveries(arg2 []int64, arg3 []int64, arg4 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddPickupsAndDeliveries_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_73)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_74)(unsafe.Pointer(&_swig_i_2)), *(*C.swig_type_75)(unsafe.Pointer(&_swig_i_3))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetDropPenalties(arg2 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetDropPenalties_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_76)(unsafe.Pointer(&_swig_i_1))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AddDisjunctionGroups(arg2 []int64, arg3 []int64, arg4 []int64, arg5 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := arg5
+	swig_r = (bool)(C._wrap_RoutingWrapper_AddDisjunctionGroups_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_77)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_78)(unsafe.Pointer(&_swig_i_2)), *(*C.swig_type_79)(unsafe.Pointer(&_swig_i_3)), *(*C.swig_type_80)(unsafe.Pointer(&_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg5
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ApplyRouteLocks(arg2 []int64, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_ApplyRouteLocks_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_81)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_82)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) CreateDefaultRoutingSearchParameters() {
+	_swig_i_0 := arg1
+	C._wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetFirstSolutionStrategy(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_83)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetLocalSearchMetaheuristic(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RoutingWrapper_SetLocalSearchMetaheuristic_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_84)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetTimeLimit(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RoutingWrapper_SetTimeLimit_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_85(_swig_i_1))
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetInstanceFeatures() (_swig_ret InstanceFeatures) {
+	var swig_r InstanceFeatures
+	_swig_i_0 := arg1
+	swig_r = (InstanceFeatures)(SwigcptrInstanceFeatures(C._wrap_RoutingWrapper_GetInstanceFeatures_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) LoadSearchRules(arg2 string) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (bool)(C._wrap_RoutingWrapper_LoadSearchRules_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_86)(unsafe.Pointer(&_swig_i_1))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetSearchRule(arg2 int) (_swig_ret SearchRule) {
+	var swig_r SearchRule
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (SearchRule)(SwigcptrSearchRule(C._wrap_RoutingWrapper_GetSearchRule_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) AutoConfigure(arg2 int64) (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (int)(C._wrap_RoutingWrapper_AutoConfigure_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_87(_swig_i_1)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SolveAutoConfigured(arg2 int64, arg3 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SolveAutoConfigured_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_88(_swig_i_1), C.swig_intgo(_swig_i_2)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetDeterministicMode(arg2 int, arg3 int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetDeterministicMode_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_type_89(_swig_i_2)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetMemoryBudget(arg2 int64, arg3 bool) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	C._wrap_RoutingWrapper_SetMemoryBudget_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_90(_swig_i_1), C._Bool(_swig_i_2))
+}
+
+func (arg1 SwigcptrRoutingWrapper) EstimateMemory() (_swig_ret MemoryEstimate) {
+	var swig_r MemoryEstimate
+	_swig_i_0 := arg1
+	swig_r = (MemoryEstimate)(SwigcptrMemoryEstimate(C._wrap_RoutingWrapper_EstimateMemory_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ComputeLowerBound(arg2 int) (_swig_ret LowerBound) {
+	var swig_r LowerBound
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (LowerBound)(SwigcptrLowerBound(C._wrap_RoutingWrapper_ComputeLowerBound_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetEarlyStopGap(arg2 float64, arg3 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	C._wrap_RoutingWrapper_SetEarlyStopGap_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.double(_swig_i_1), C.swig_intgo(_swig_i_2))
+}
+
+func (arg1 SwigcptrRoutingWrapper) SolveWithCurrentParameters() (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	swig_r = (bool)(C._wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetReplayLog() (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_RoutingWrapper_GetReplayLog_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRoutingWrapper) HasSolution() (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	swig_r = (bool)(C._wrap_RoutingWrapper_HasSolution_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetObjectiveValue() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RoutingWrapper_GetObjectiveValue_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetRoute(arg2 int) (_swig_ret []int64) {
+	var swig_r []int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r_p := C._wrap_RoutingWrapper_GetRoute_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+	swig_r = *(*[]int64)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 []int64
+  swig_r_1 = make([]int64, len(swig_r))
+  copy(swig_r_1, swig_r)
+  if len(swig_r) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&swig_r[0])))
+  }
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRoutingWrapper) GetDroppedNodes() (_swig_ret []int64) {
+	var swig_r []int64
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_RoutingWrapper_GetDroppedNodes_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*[]int64)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 []int64
+  swig_r_1 = make([]int64, len(swig_r))
+  copy(swig_r_1, swig_r)
+  if len(swig_r) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&swig_r[0])))
+  }
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRoutingWrapper) ImproveRoutesAfterSolve(arg2 int, arg3 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_ImproveRoutesAfterSolve_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ImproveWithRuinAndRecreate(arg2 int, arg3 int, arg4 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	swig_r = (bool)(C._wrap_RoutingWrapper_ImproveWithRuinAndRecreate_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) SetNodeCoordinates(arg2 []float64, arg3 []float64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RoutingWrapper_SetNodeCoordinates_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_95)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_96)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ExportBinaryToBuffer(arg2 []byte, arg4 string) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg4
+	swig_r = (int64)(C._wrap_RoutingWrapper_ExportBinaryToBuffer_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_98)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_99)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ExportBinaryToFd(arg2 int, arg3 string) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (int64)(C._wrap_RoutingWrapper_ExportBinaryToFd_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), *(*C.swig_type_101)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ExportGeoJsonToBuffer(arg2 []byte, arg4 string) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg4
+	swig_r = (int64)(C._wrap_RoutingWrapper_ExportGeoJsonToBuffer_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_103)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_104)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg4
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) ExportGeoJsonToFd(arg2 int, arg3 string) (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (int64)(C._wrap_RoutingWrapper_ExportGeoJsonToFd_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), *(*C.swig_type_106)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRoutingWrapper) PrintSolution() {
+	_swig_i_0 := arg1
+	C._wrap_RoutingWrapper_PrintSolution_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+func DeleteRoutingWrapper(arg1 RoutingWrapper) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_RoutingWrapper_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type RoutingWrapper interface {
+	Swigcptr() uintptr
+	SwigIsRoutingWrapper()
+	InitDataModel(arg2 DistanceMatrix, arg3 int, arg4 int)
+	InitFlatDataModel(arg2 []int64, arg3 int, arg4 int, arg5 int) (_swig_ret bool)
+	InitRoadGraphDataModel(arg2 string, arg3 []int64, arg4 int, arg5 int, arg6 int) (_swig_ret bool)
+	InitRoadGraphMatrixDataModel(arg2 string, arg3 []int64, arg4 int, arg5 int, arg6 int) (_swig_ret bool)
+	SetVehicleStartsAndEnds(arg2 []int64, arg3 []int64) (_swig_ret bool)
+	GetData() (_swig_ret DataModel)
+	SetVehicleClasses(arg2 []int64, arg3 []float64, arg4 []float64, arg5 []int64) (_swig_ret bool)
+	CreateRoutingIndexManager(arg2 DataModel)
+	CreateRoutingModel()
+	CreateRoutingModelFromData()
+	RegisterTransitCallback() (_swig_ret int)
+	SetDemands(arg2 []int64, arg3 []int64) (_swig_ret bool)
+	AddCapacityDimension(arg2 string) (_swig_ret bool)
+	SetServiceTimes(arg2 []int64) (_swig_ret bool)
+	AddTimeDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool)
+	AggregateColocatedStops() (_swig_ret int)
+	GetNodeGroups() (_swig_ret []int64)
+	AddVehicleClassTimeDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool)
+	AddTravelTimeProfile(arg2 []int64, arg3 []float64) (_swig_ret int)
+	SetTravelTimeZones(arg2 []int64, arg3 []int64) (_swig_ret bool)
+	AddTimeDependentDimension(arg2 int64, arg3 int64, arg4 bool, arg5 string) (_swig_ret bool)
+	AddDimension(arg2 int, arg3 int, arg4 int, arg5 bool, arg6 string) (_swig_ret bool)
+	AddDimensionWithVehicleCapacity(arg2 int, arg3 int64, arg4 []int64, arg5 bool, arg6 string) (_swig_ret bool)
+	SetGlobalSpanCostCoefficient(arg2 string, arg3 int64) (_swig_ret bool)
+	SetSpanUpperBounds(arg2 string, arg3 []int64) (_swig_ret bool)
+	SetCumulSoftUpperBounds(arg2 string, arg3 []int64, arg4 []int64, arg5 []int64) (_swig_ret bool)
+	SetRouteEndSoftUpperBounds(arg2 string, arg3 []int64, arg4 []int64) (_swig_ret bool)
+	AddPickupsAndDeliveries(arg2 []int64, arg3 []int64, arg4 string) (_swig_ret bool)
+	SetDropPenalties(arg2 []int64) (_swig_ret bool)
+	AddDisjunctionGroups(arg2 []int64, arg3 []int64, arg4 []int64, arg5 []int64) (_swig_ret bool)
+	ApplyRouteLocks(arg2 []int64, arg3 []int64) (_swig_ret bool)
+	CreateDefaultRoutingSearchParameters()
+	SetFirstSolutionStrategy(arg2 string)
+	SetLocalSearchMetaheuristic(arg2 string)
+	SetTimeLimit(arg2 int64)
+	GetInstanceFeatures() (_swig_ret InstanceFeatures)
+	LoadSearchRules(arg2 string) (_swig_ret bool)
+	GetSearchRule(arg2 int) (_swig_ret SearchRule)
+	AutoConfigure(arg2 int64) (_swig_ret int)
+	SolveAutoConfigured(arg2 int64, arg3 int) (_swig_ret bool)
+	SetDeterministicMode(arg2 int, arg3 int64) (_swig_ret bool)
+	SetMemoryBudget(arg2 int64, arg3 bool)
+	EstimateMemory() (_swig_ret MemoryEstimate)
+	ComputeLowerBound(arg2 int) (_swig_ret LowerBound)
+	SetEarlyStopGap(arg2 float64, arg3 int)
+	SolveWithCurrentParameters() (_swig_ret bool)
+	GetReplayLog() (_swig_ret string)
+	HasSolution() (_swig_ret bool)
+	GetObjectiveValue() (_swig_ret int64)
+	GetRoute(arg2 int) (_swig_ret []int64)
+	GetDroppedNodes() (_swig_ret []int64)
+	ImproveRoutesAfterSolve(arg2 int, arg3 int) (_swig_ret bool)
+	ImproveWithRuinAndRecreate(arg2 int, arg3 int, arg4 int) (_swig_ret bool)
+	SetNodeCoordinates(arg2 []float64, arg3 []float64) (_swig_ret bool)
+	ExportBinaryToBuffer(arg2 []byte, arg4 string) (_swig_ret int64)
+	ExportBinaryToFd(arg2 int, arg3 string) (_swig_ret int64)
+	ExportGeoJsonToBuffer(arg2 []byte, arg4 string) (_swig_ret int64)
+	ExportGeoJsonToFd(arg2 int, arg3 string) (_swig_ret int64)
+	PrintSolution()
+}
+
+type SwigcptrRollingHorizonOptions uintptr
+
+func (p SwigcptrRollingHorizonOptions) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrRollingHorizonOptions) SwigIsRollingHorizonOptions() {
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetMax_batch_orders(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_max_batch_orders_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetMax_batch_orders() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_RollingHorizonOptions_max_batch_orders_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetLocked_visits(arg2 int) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_locked_visits_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetLocked_visits() (_swig_ret int) {
+	var swig_r int
+	_swig_i_0 := arg1
+	swig_r = (int)(C._wrap_RollingHorizonOptions_locked_visits_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetTime_limit_ms(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_time_limit_ms_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_107(_swig_i_1))
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetTime_limit_ms() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RollingHorizonOptions_time_limit_ms_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetFirst_solution_strategy(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_first_solution_strategy_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_109)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetFirst_solution_strategy() (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_RollingHorizonOptions_first_solution_strategy_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetMetaheuristic(arg2 string) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_metaheuristic_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_111)(unsafe.Pointer(&_swig_i_1)))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetMetaheuristic() (_swig_ret string) {
+	var swig_r string
+	_swig_i_0 := arg1
+	swig_r_p := C._wrap_RollingHorizonOptions_metaheuristic_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+	swig_r = *(*string)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 string
+ swig_r_1 = swigCopyString(swig_r) 
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) SetDrop_penalty(arg2 int64) {
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	C._wrap_RollingHorizonOptions_drop_penalty_set_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_113(_swig_i_1))
+}
+
+func (arg1 SwigcptrRollingHorizonOptions) GetDrop_penalty() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RollingHorizonOptions_drop_penalty_get_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func NewRollingHorizonOptions() (_swig_ret RollingHorizonOptions) {
+	var swig_r RollingHorizonOptions
+	swig_r = (RollingHorizonOptions)(SwigcptrRollingHorizonOptions(C._wrap_new_RollingHorizonOptions_constraint_solver_095582e9481db22a()))
+	return swig_r
+}
+
+func DeleteRollingHorizonOptions(arg1 RollingHorizonOptions) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_RollingHorizonOptions_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type RollingHorizonOptions interface {
+	Swigcptr() uintptr
+	SwigIsRollingHorizonOptions()
+	SetMax_batch_orders(arg2 int)
+	GetMax_batch_orders() (_swig_ret int)
+	SetLocked_visits(arg2 int)
+	GetLocked_visits() (_swig_ret int)
+	SetTime_limit_ms(arg2 int64)
+	GetTime_limit_ms() (_swig_ret int64)
+	SetFirst_solution_strategy(arg2 string)
+	GetFirst_solution_strategy() (_swig_ret string)
+	SetMetaheuristic(arg2 string)
+	GetMetaheuristic() (_swig_ret string)
+	SetDrop_penalty(arg2 int64)
+	GetDrop_penalty() (_swig_ret int64)
+}
+
+type SwigcptrRollingHorizonPlanner uintptr
+
+func (p SwigcptrRollingHorizonPlanner) Swigcptr() uintptr {
+	return (uintptr)(p)
+}
+
+func (p SwigcptrRollingHorizonPlanner) SwigIsRollingHorizonPlanner() {
+}
+
+func NewRollingHorizonPlanner(arg1 []int64, arg2 int, arg3 int, arg4 int, arg5 RollingHorizonOptions) (_swig_ret RollingHorizonPlanner) {
+	var swig_r RollingHorizonPlanner
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	_swig_i_3 := arg4
+	_swig_i_4 := getSwigcptr(arg5)
+	swig_r = (RollingHorizonPlanner)(SwigcptrRollingHorizonPlanner(C._wrap_new_RollingHorizonPlanner_constraint_solver_095582e9481db22a(*(*C.swig_type_115)(unsafe.Pointer(&_swig_i_0)), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2), C.swig_intgo(_swig_i_3), C.uintptr_t(_swig_i_4))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg1
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) IsValid() (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	swig_r = (bool)(C._wrap_RollingHorizonPlanner_IsValid_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) SetDemands(arg2 []int64, arg3 []int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RollingHorizonPlanner_SetDemands_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), *(*C.swig_type_116)(unsafe.Pointer(&_swig_i_1)), *(*C.swig_type_117)(unsafe.Pointer(&_swig_i_2))))
+	if Swig_escape_always_false {
+		Swig_escape_val = arg2
+	}
+	if Swig_escape_always_false {
+		Swig_escape_val = arg3
+	}
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) QueueOrder(arg2 int64) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r = (bool)(C._wrap_RollingHorizonPlanner_QueueOrder_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_type_118(_swig_i_1)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) CommitVisits(arg2 int, arg3 int) (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	_swig_i_2 := arg3
+	swig_r = (bool)(C._wrap_RollingHorizonPlanner_CommitVisits_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1), C.swig_intgo(_swig_i_2)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) ProcessBatch() (_swig_ret bool) {
+	var swig_r bool
+	_swig_i_0 := arg1
+	swig_r = (bool)(C._wrap_RollingHorizonPlanner_ProcessBatch_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) GetCommittedVisits(arg2 int) (_swig_ret []int64) {
+	var swig_r []int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r_p := C._wrap_RollingHorizonPlanner_GetCommittedVisits_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+	swig_r = *(*[]int64)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 []int64
+  swig_r_1 = make([]int64, len(swig_r))
+  copy(swig_r_1, swig_r)
+  if len(swig_r) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&swig_r[0])))
+  }
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) GetOpenVisits(arg2 int) (_swig_ret []int64) {
+	var swig_r []int64
+	_swig_i_0 := arg1
+	_swig_i_1 := arg2
+	swig_r_p := C._wrap_RollingHorizonPlanner_GetOpenVisits_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0), C.swig_intgo(_swig_i_1))
+	swig_r = *(*[]int64)(unsafe.Pointer(&swig_r_p))
+	var swig_r_1 []int64
+  swig_r_1 = make([]int64, len(swig_r))
+  copy(swig_r_1, swig_r)
+  if len(swig_r) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&swig_r[0])))
+  }
+	return swig_r_1
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) GetQueuedOrders() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RollingHorizonPlanner_GetQueuedOrders_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) GetLastModelSize() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RollingHorizonPlanner_GetLastModelSize_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func (arg1 SwigcptrRollingHorizonPlanner) GetLastBatchMs() (_swig_ret int64) {
+	var swig_r int64
+	_swig_i_0 := arg1
+	swig_r = (int64)(C._wrap_RollingHorizonPlanner_GetLastBatchMs_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0)))
+	return swig_r
+}
+
+func DeleteRollingHorizonPlanner(arg1 RollingHorizonPlanner) {
+	_swig_i_0 := getSwigcptr(arg1)
+	C._wrap_delete_RollingHorizonPlanner_constraint_solver_095582e9481db22a(C.uintptr_t(_swig_i_0))
+}
+
+type RollingHorizonPlanner interface {
+	Swigcptr() uintptr
+	SwigIsRollingHorizonPlanner()
+	IsValid() (_swig_ret bool)
+	SetDemands(arg2 []int64, arg3 []int64) (_swig_ret bool)
+	QueueOrder(arg2 int64) (_swig_ret bool)
+	CommitVisits(arg2 int, arg3 int) (_swig_ret bool)
+	ProcessBatch() (_swig_ret bool)
+	GetCommittedVisits(arg2 int) (_swig_ret []int64)
+	GetOpenVisits(arg2 int) (_swig_ret []int64)
+	GetQueuedOrders() (_swig_ret int64)
+	GetLastModelSize() (_swig_ret int64)
+	GetLastBatchMs() (_swig_ret int64)
+}
+
+
@@ -2,6 +2,7 @@
 #define VRP_H
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -10,19 +11,133 @@
 #include "ortools/constraint_solver/routing_index_manager.h"
 #include "ortools/constraint_solver/routing_parameters.h"
 
+#include "auto_config.h"
+#include "flat_matrix.h"
+#include "road_graph.h"
+#include "ruin_recreate.h"
+#include "solution_export.h"
+#include "stop_aggregation.h"
+#include "travel_time_profile.h"
+
 namespace constraint_solver {
 struct DataModel {
-  std::vector<std::vector<double>> distance_matrix;
+  // Integral distances read by the callbacks and the wrapper's own
+  // heuristics; InitDataModel converts its nested matrix into it.
+  FlatMatrix flat_distance_matrix;
+  // When set, distances come from the road graph on demand and the matrix
+  // above stays empty. Shared so that copies of the model share one cache.
+  std::shared_ptr<LazyDistanceOracle> distance_oracle;
   int num_vehicles;
   operations_research::RoutingIndexManager::NodeIndex depot;
+  // Per-vehicle start and end nodes. When empty every vehicle starts and ends
+  // at depot.
+  std::vector<operations_research::RoutingIndexManager::NodeIndex> starts;
+  std::vector<operations_research::RoutingIndexManager::NodeIndex> ends;
+  // Demand of every node and capacity of every vehicle, set together by
+  // SetDemands.
+  std::vector<int64_t> demands;
   std::vector<int64_t> vehicle_capacities;
+  // Time spent at every node, added to the time dimensions on departure.
+  // Empty means none.
+  std::vector<int64_t> service_times;
+  // Heterogeneous fleet: class of every vehicle, and per class the multiplier
+  // applied to the base matrix for arc costs, the divisor applied to it for
+  // travel times and the fixed cost of using a vehicle. Empty for a
+  // homogeneous fleet.
+  std::vector<int64_t> vehicle_classes;
+  std::vector<double> class_cost_multipliers;
+  std::vector<double> class_speed_factors;
+  std::vector<int64_t> class_fixed_costs;
+  // Time-dependent travel times. Nodes are grouped into zones and the arc
+  // between two nodes uses the profile
+  // zone_profiles[node_zones[from] * num_zones + node_zones[to]]. Without
+  // zones every arc uses the constant profile 0.
+  TravelTimeProfileTable travel_time_profiles;
+  std::vector<int32_t> node_zones;
+  std::vector<uint16_t> zone_profiles;
+  int num_zones = 0;
+  // Node positions used by the GeoJSON export; empty when unknown.
+  std::vector<double> node_longitudes;
+  std::vector<double> node_latitudes;
+
+  int64_t ServiceTime(int node) const {
+    return service_times.empty() ? 0 : service_times[node];
+  }
+  int num_nodes() const {
+    return distance_oracle ? distance_oracle->num_nodes()
+                           : flat_distance_matrix.size();
+  }
+  int64_t Distance(int from_node, int to_node) const {
+    return distance_oracle ? distance_oracle->Distance(from_node, to_node)
+                           : flat_distance_matrix(from_node, to_node);
+  }
+
+  const TravelTimeProfile &ArcProfile(int from_node, int to_node) const {
+    if (node_zones.empty()) {
+      return travel_time_profiles.Get(0);
+    }
+    return travel_time_profiles.Get(
+        zone_profiles[static_cast<int64_t>(node_zones[from_node]) * num_zones +
+                      node_zones[to_node]]);
+  }
+};
+
+// Estimated memory of one solve, in bytes.
+struct MemoryEstimate {
+  // Distance matrices and travel time zones.
+  int64_t matrix_bytes = 0;
+  int64_t index_manager_bytes = 0;
+  // Model variables and the routing model's transit callback caches.
+  int64_t model_bytes = 0;
+  // Neighbor structures of the insertion heuristics and stored assignments.
+  int64_t search_bytes = 0;
+  int64_t total_bytes = 0;
+};
+
+// Lower bounds for the current model.
+struct LowerBound {
+  // Bound on the objective, 0 when the model has features the bound does
+  // not cover (droppable nodes, several depots, a road graph oracle).
+  int64_t objective = 0;
+  // Fewest vehicles able to carry the demand, -1 if the fleet cannot.
+  int min_vehicles = 0;
 };
 
 class RoutingWrapper {
 public:
   RoutingWrapper();
+  // Every Init*DataModel starts a new instance: starts, ends, demands,
+  // service times, vehicle classes, travel time zones and coordinates set
+  // for the previous one are cleared; travel time profiles are kept.
   void InitDataModel(std::vector<std::vector<double>> distance_matrix,
                      int num_vehicles, int depotIndex);
+  // Same as InitDataModel from a row-major num_nodes x num_nodes matrix of
+  // integral distances, which is moved into the model without conversion.
+  // Returns false on a size mismatch.
+  bool InitFlatDataModel(std::vector<int64_t> distances, int num_nodes,
+                         int num_vehicles, int depotIndex);
+  // Same as InitDataModel without a matrix: loads a CSR road graph (see
+  // LoadRoadGraph) and computes the distances between nodes lazily, node i
+  // being graph vertex node_vertices[i]. At most max_cached_rows rows of
+  // distances are kept. Returns false if the graph cannot be loaded or a
+  // vertex does not exist.
+  bool InitRoadGraphDataModel(const std::string &graph_path,
+                              std::vector<int64_t> node_vertices,
+                              int num_vehicles, int depotIndex,
+                              int max_cached_rows);
+  // Same graph and node mapping, but the full matrix is computed up front
+  // on num_threads threads (all cores when <= 0) and stored in
+  // flat_distance_matrix, as with InitFlatDataModel.
+  bool InitRoadGraphMatrixDataModel(const std::string &graph_path,
+                                    std::vector<int64_t> node_vertices,
+                                    int num_vehicles, int depotIndex,
+                                    int num_threads);
+  // Sets the start and end node of every vehicle at once, for fleets that do
+  // not share a single depot. Must be called after InitDataModel and before
+  // CreateRoutingIndexManager. Returns false if the arrays do not have one
+  // entry per vehicle or reference unknown nodes.
+  bool SetVehicleStartsAndEnds(std::vector<int64_t> starts,
+                               std::vector<int64_t> ends);
 
   // getters
   DataModel getData() { return data; }
@@ -31,9 +146,81 @@ public:
   // operations_research::RoutingSearchParameters getSearchParameters() { return searchParameters; }
   // const operations_research::Assignment *getSolution() const { return solution; }
 
+  // Assigns every vehicle to a vehicle class in one call. All classes share
+  // the base distance matrix; their cost multiplier, speed factor and fixed
+  // cost are applied inside the callbacks. Must be called before
+  // RegisterTransitCallback. Returns false on inconsistent array sizes,
+  // unknown classes, cost multipliers or speed factors that are not finite
+  // and positive, or negative fixed costs.
+  bool SetVehicleClasses(std::vector<int64_t> vehicle_classes,
+                         std::vector<double> cost_multipliers,
+                         std::vector<double> speed_factors,
+                         std::vector<int64_t> fixed_costs);
+
   void CreateRoutingIndexManager(DataModel data);
   void CreateRoutingModel();
+  // Creates the index manager and the model from the wrapper's own data in
+  // one call, without copying the DataModel.
+  void CreateRoutingModelFromData();
+  // Registers the base distance callback and returns its index. Arc costs
+  // use it directly for a homogeneous fleet, and one scaled callback per
+  // vehicle class otherwise.
   int RegisterTransitCallback();
+  // Sets the demand of every node and the capacity of every vehicle.
+  // Returns false on size mismatches or negative values.
+  bool SetDemands(std::vector<int64_t> demands,
+                  std::vector<int64_t> vehicle_capacities);
+  // Adds a capacity dimension over the demands of SetDemands. Returns false
+  // if they were not set for the current instance.
+  bool AddCapacityDimension(const std::string &name);
+  // Sets the service time of every node. Returns false on a size mismatch
+  // or negative values.
+  bool SetServiceTimes(std::vector<int64_t> service_times);
+  // Adds a time dimension whose transits are the distances plus the service
+  // time of the origin node, for a homogeneous fleet.
+  bool AddTimeDimension(int64_t slack_max, int64_t capacity,
+                        bool fix_start_cumul_to_zero, const std::string &name);
+  // Merges co-located stops (distance 0 both ways, or identical
+  // coordinates) into super-nodes with summed demands and service times,
+  // shrinking the model. Depots, starts and ends are never merged, nor
+  // stops in different travel time zones, and a super-node never carries
+  // more demand than the largest vehicle capacity: heavier locations are
+  // split over several super-nodes. Must be called after the data
+  // setup and before the model is created; afterwards the model-building
+  // calls take super-node ids (see GetNodeGroups), while routes, dropped
+  // nodes and exports list the original nodes, each group in increasing
+  // order with the cumul of its super-node. Returns the number of nodes
+  // left, or -1 if the model of this instance already exists or it uses a
+  // road graph oracle.
+  int AggregateColocatedStops();
+  // Super-node of every original node; empty without aggregation.
+  std::vector<int64_t> GetNodeGroups();
+  // Adds a dimension whose transits are the base distances divided by the
+  // speed factor of each vehicle's class, plus the service time of the
+  // origin node.
+  bool AddVehicleClassTimeDimension(int64_t slack_max, int64_t capacity,
+                                    bool fix_start_cumul_to_zero,
+                                    const std::string &name);
+
+  // Adds a piecewise-linear travel time multiplier and returns its id.
+  // Identical profiles share one id. Returns -1 on invalid profiles.
+  int AddTravelTimeProfile(std::vector<int64_t> breakpoints,
+                           std::vector<double> factors);
+  // Assigns every node a zone and every (from zone, to zone) pair a profile
+  // id, row-major. Passing one zone per node gives per-arc profiles.
+  bool SetTravelTimeZones(std::vector<int64_t> node_zones,
+                          std::vector<int64_t> zone_profiles);
+  // Adds a self-based dimension whose transit from a node is its service
+  // time plus the base distance scaled by the arc profile at the departure
+  // that follows. The routing model caches two heap objects, about 100
+  // bytes, for every arc it evaluates, up to num_nodes^2 of them: about
+  // 1 GB at 3000 nodes. The memory estimate counts them in full, and no
+  // downgrade shrinks them. Returns false if the zones were set for an
+  // instance of another size, or if the estimate with these caches exceeds
+  // the memory budget.
+  bool AddTimeDependentDimension(int64_t slack_max, int64_t horizon,
+                                 bool fix_start_cumul_to_zero,
+                                 const std::string &name);
 
   bool AddDimension(int evaluator_index, int slack_max, int capacity,
                     bool fix_start_cumul_to_zero, const std::string &name);
@@ -41,18 +228,237 @@ public:
                                        std::vector<int64_t> vehicle_capacities,
                                        bool fix_start_cumul_to_zero,
                                        const std::string &name);
+  // Objective controls on a dimension added earlier; all return false if the
+  // dimension does not exist or the arrays are inconsistent.
+  // Adds coefficient * (max route end cumul - min route start cumul), which
+  // balances routes by penalizing the longest one.
+  bool SetGlobalSpanCostCoefficient(const std::string &dimension_name,
+                                    int64_t coefficient);
+  // Hard upper bound on end cumul - start cumul, one entry per vehicle.
+  bool SetSpanUpperBounds(const std::string &dimension_name,
+                          std::vector<int64_t> upper_bounds);
+  // Soft upper bounds on node cumuls: exceeding upper_bounds[i] at nodes[i]
+  // costs coefficients[i] per unit.
+  bool SetCumulSoftUpperBounds(const std::string &dimension_name,
+                               std::vector<int64_t> nodes,
+                               std::vector<int64_t> upper_bounds,
+                               std::vector<int64_t> coefficients);
+  // Same on the route end cumul of every vehicle, one entry per vehicle.
+  bool SetRouteEndSoftUpperBounds(const std::string &dimension_name,
+                                  std::vector<int64_t> upper_bounds,
+                                  std::vector<int64_t> coefficients);
+  // Adds pickup and delivery pairs in bulk: deliveries[i] is served by the
+  // same vehicle as pickups[i], after it on the cumuls of dimension_name.
+  // Unless a first solution strategy is set, solves then start from
+  // PARALLEL_CHEAPEST_INSERTION. Returns false, adding nothing, on mismatched
+  // sizes, unknown or depot nodes, an unknown dimension, a pickup equal to
+  // its delivery, or a node already in a pair of this or an earlier call.
+  bool AddPickupsAndDeliveries(std::vector<int64_t> pickups,
+                               std::vector<int64_t> deliveries,
+                               const std::string &dimension_name);
+  // Makes every node with a non-negative penalty optional, dropping it
+  // costing its penalty. One entry per node; nodes with negative entries
+  // stay mandatory. Returns false, adding nothing, on a size mismatch, a
+  // non-negative penalty for the depot or a vehicle start or end, or a
+  // second call on the same model.
+  bool SetDropPenalties(std::vector<int64_t> penalties);
+  // Adds disjunctions from flat arrays: group g is the next group_sizes[g]
+  // entries of nodes, at most max_cardinalities[g] of them are visited, and
+  // penalties[g] is paid for each visit short of max_cardinalities[g].
+  // Returns false, adding nothing, on inconsistent sizes or unknown or depot
+  // nodes.
+  bool AddDisjunctionGroups(std::vector<int64_t> nodes,
+                            std::vector<int64_t> group_sizes,
+                            std::vector<int64_t> penalties,
+                            std::vector<int64_t> max_cardinalities);
+  // Freezes the head of every route for the solves of the current model:
+  // route v starts with the next lock_sizes[v] entries of nodes, in order.
+  // The locks need a closed model, so they are applied by the solve once it
+  // closed the model with its parameters; dimensions and disjunctions may
+  // still be added after this call. Returns false, keeping the previous
+  // locks, on inconsistent sizes, unknown, depot or repeated nodes.
+  bool ApplyRouteLocks(std::vector<int64_t> nodes,
+                       std::vector<int64_t> lock_sizes);
   void CreateDefaultRoutingSearchParameters();
   void SetFirstSolutionStrategy(std::string strategy);
-  void SolveWithCurrentParameters();
+  // One of AUTOMATIC, GREEDY_DESCENT, GUIDED_LOCAL_SEARCH,
+  // SIMULATED_ANNEALING, TABU_SEARCH or GENERIC_TABU_SEARCH; kept across
+  // CreateDefaultRoutingSearchParameters like the first solution strategy.
+  void SetLocalSearchMetaheuristic(std::string metaheuristic);
+  void SetTimeLimit(int64_t milliseconds);
+  // Features of the current instance, as matched by AutoConfigure. Logged
+  // next to benchmark results they are the input for tuning the rules.
+  InstanceFeatures GetInstanceFeatures();
+  // Replaces the auto-configuration rules, see LoadSearchRules for the
+  // format. Returns false, keeping the current rules, if the file is
+  // malformed.
+  bool LoadSearchRules(const std::string &path);
+  // Rule at index, e.g. the one returned by AutoConfigure; a rule with empty
+  // names if index is out of range.
+  SearchRule GetSearchRule(int index);
+  // Picks the first solution strategy, the metaheuristic and the share of
+  // time_limit_ms given to the search from the first rule matching the
+  // instance features, and sets the search time limit. The first solution
+  // strategy is left alone with pickups and deliveries. Returns the index of
+  // the rule, or -1 if none matches or the model uses a road graph oracle.
+  int AutoConfigure(int64_t time_limit_ms);
+  // AutoConfigure, solve, then spend the rest of time_limit_ms on ruin and
+  // recreate over num_threads threads. Returns true if a solution was found.
+  bool SolveAutoConfigured(int64_t time_limit_ms, int num_threads);
+  // Makes solves reproducible across runs and builds: the solver is reseeded
+  // with seed, wall-clock limits are replaced by solution_limit and the LNS
+  // operators bounded by lns_time_limit are disabled. Returns false, leaving
+  // the mode unchanged, if solution_limit is not positive.
+  bool SetDeterministicMode(int32_t seed, int64_t solution_limit);
+  // Caps the estimated memory of a solve; 0 disables the budget. Set it
+  // before CreateRoutingModel, which checks it before any callback fills its
+  // cache: over budget, the model stores the flat matrix in 32 bits and, if
+  // that is not enough, leaves the transit callbacks uncached, or, without
+  // allow_downgrade, rejects all its solves. The solve then prunes insertion
+  // neighbors if allowed and is rejected if the estimate still does not fit.
+  void SetMemoryBudget(int64_t budget_bytes, bool allow_downgrade);
+  MemoryEstimate EstimateMemory();
+  // Computes a Lagrangian spanning-forest bound on the route distances on
+  // num_threads threads (all cores when <= 0), scaled by the cheapest vehicle
+  // class, and a bin-packing bound on the number of vehicles.
+  LowerBound ComputeLowerBound(int num_threads);
+  // Makes every solve compute the lower bound first and stop the search as
+  // soon as (best objective - bound) <= relative_gap * best objective. 0
+  // disables it.
+  void SetEarlyStopGap(double relative_gap, int num_threads);
+  // Returns true if a solution was found; false also when the solve was
+  // rejected by the memory budget, see GetReplayLog.
+  bool SolveWithCurrentParameters();
+  // Parameters, seed and objective trajectory of every solve so far, one
+  // block per solve.
+  std::string GetReplayLog() { return replayLog; }
+  bool HasSolution() { return solution != nullptr; }
+  int64_t GetObjectiveValue() {
+    return solution != nullptr ? solution->ObjectiveValue() : 0;
+  }
+  // Nodes visited by vehicle in the current solution, its start and end
+  // included. Empty when there is no solution.
+  std::vector<int64_t> GetRoute(int vehicle);
+  // Nodes left unvisited by the current solution.
+  std::vector<int64_t> GetDroppedNodes();
+  // Post-optimizes the current solution route by route with 2-opt and Or-opt
+  // over the flat matrix, in parallel on num_threads threads (all cores when
+  // <= 0). The improved routes replace the solution only if the model accepts
+  // them with a lower objective. Returns true if the solution changed, and
+  // false without trying if num_neighbors < 1. Needs the flat matrix, so
+  // does nothing on a road graph data model.
+  bool ImproveRoutesAfterSolve(int num_neighbors, int num_threads);
+  // Post-optimizes the current solution with iterations ruin and recreate
+  // attempts (regret insertion, capacities of SetDemands respected) spread
+  // over num_threads threads, reproducible for a given seed and thread
+  // count. Written back like ImproveRoutesAfterSolve, under the same
+  // conditions. Returns true if the solution changed.
+  bool ImproveWithRuinAndRecreate(int iterations, int num_threads,
+                                  int32_t seed);
+  // Node positions for the GeoJSON export, one finite entry per node.
+  bool SetNodeCoordinates(std::vector<double> longitudes,
+                          std::vector<double> latitudes);
+  // Stream the current solution without building it in memory (see
+  // solution_export.h for the formats). dimension_name selects the cumuls
+  // exported with every visit; empty exports none. The buffer variants fill
+  // at most capacity bytes and return the size of the whole export, so a
+  // caller retries with a larger buffer when it exceeds capacity; the fd
+  // variants return the bytes written. All return -1 without a solution, on
+  // an unknown dimension or a write error, and the GeoJSON ones also without
+  // coordinates.
+  int64_t ExportBinaryToBuffer(char *buffer, int64_t capacity,
+                               const std::string &dimension_name);
+  int64_t ExportBinaryToFd(int fd, const std::string &dimension_name);
+  int64_t ExportGeoJsonToBuffer(char *buffer, int64_t capacity,
+                                const std::string &dimension_name);
+  int64_t ExportGeoJsonToFd(int fd, const std::string &dimension_name);
   void PrintSolution();
 
 private:
+  void CreateIndexManager(const DataModel &model);
+  // Clears the node and vehicle data of the previous instance and drops its
+  // model, called by every Init*DataModel.
+  void ResetInstanceData();
+  // Loads the graph of the InitRoadGraph* functions and maps the nodes to
+  // its vertices. Returns false on invalid arguments.
+  static bool LoadNodeVertices(const std::string &graph_path,
+                               const std::vector<int64_t> &node_vertices,
+                               int num_vehicles, int depotIndex,
+                               RoadGraph *graph,
+                               std::vector<int32_t> *vertices);
+  MemoryEstimate EstimateMemoryFor(
+      const operations_research::RoutingSearchParameters &parameters) const;
+  // Transit caches of one time-dependent dimension when every arc is
+  // evaluated.
+  int64_t StateDependentTransitBytes() const;
+  // Prunes insertion neighbors in parameters, if allowed, until the estimate
+  // fits the budget. Returns false, leaving parameters unchanged, if it
+  // still does not.
+  bool FitMemoryBudget(
+      operations_research::RoutingSearchParameters *parameters) const;
+  // Routing index of a node that can be visited, or kUnassigned for unknown
+  // nodes and vehicle starts and ends.
+  int64_t VisitIndex(int64_t node) const;
+  // Node sequence of every vehicle in solution, starts and ends included.
+  std::vector<std::vector<int64_t>> ExtractRoutes() const;
+  bool RunRuinAndRecreate(const RuinRecreateOptions &options);
+  // Loads improved_routes into the model and keeps them if the model accepts
+  // them with a lower objective, restoring routes otherwise.
+  bool ReplaceRoutesIfBetter(
+      const std::vector<std::vector<int64_t>> &routes,
+      const std::vector<std::vector<int64_t>> &improved_routes);
+  // Feeds the current solution to exporter route by route and returns the
+  // size of the export, or -1.
+  int64_t ExportSolution(const std::string &dimension_name,
+                         RouteExporter *exporter, ExportSink *sink) const;
+  bool HasCoordinates() const;
+  // Nodes before aggregation.
+  int NumOriginalNodes() const;
+  // Appends the original nodes behind a (super-)node.
+  void AppendOriginalNodes(int64_t node, std::vector<int64_t> *nodes) const;
+
   std::unique_ptr<operations_research::RoutingIndexManager> manager;
   std::unique_ptr<operations_research::RoutingModel> routing;
   DataModel data;
+  // Co-located stop groups; empty without aggregation.
+  StopGroups stopGroups;
   operations_research::RoutingSearchParameters searchParameters;
   operations_research::FirstSolutionStrategy_Value firstSolutionStrategy;
+  operations_research::LocalSearchMetaheuristic_Value localSearchMetaheuristic;
+  std::vector<SearchRule> searchRules;
+  // Time left to ruin and recreate by the last AutoConfigure.
+  int64_t postOptimizationMs = 0;
   const operations_research::Assignment *solution;
+  bool hasPickupsAndDeliveries = false;
+  // Routing indices in a pickup and delivery pair of the current model.
+  std::vector<bool> pairedIndices;
+  bool dropPenaltiesSet = false;
+  bool hasDisjunctions = false;
+  // Routing indices locked at the head of every route, by ApplyRouteLocks.
+  std::vector<std::vector<int64_t>> routeLocks;
+  // Time-dependent dimensions of the current model, for the estimate.
+  int timeDependentDimensions = 0;
+  int64_t memoryBudget = 0;
+  bool allowMemoryDowngrade = false;
+  // Decided by CreateRoutingModel against the budget: whether the model
+  // caches its transit callbacks, and whether it exceeds the budget without
+  // downgrades allowed, so its solves are rejected.
+  bool cacheCallbacks = true;
+  bool modelOverBudget = false;
+  bool deterministic = false;
+  int32_t deterministicSeed = 0;
+  int64_t deterministicSolutionLimit = 0;
+  double earlyStopGap = 0;
+  int earlyStopThreads = 0;
+  int64_t earlyStopBound = 0;
+  bool earlyStopLimitAdded = false;
+  bool trajectoryCallbackAdded = false;
+  // True only inside SolveWithParameters; gates the trajectory callback and
+  // the early stop limit.
+  bool solveInProgress = false;
+  std::vector<int64_t> objectiveTrajectory;
+  int64_t bestObjective = 0;
+  std::string replayLog;
   // Solver solver;
 };
 } // namespace constraint_solver
@@ -1,11 +1,13 @@
-
 %module constraint_solver
 %{
 #include "constraint_solver.h"
+#include "solve.h"
+#include "rolling_horizon.h"
+#include "auto_config.h"
 %}
 %include "std_string.i"
 %include "std_vector.i"
-%include "constraint_solver.h"
+%include "stdint.i"
 
 namespace std {
     %template(DoubleVector) vector<double>;
@@ -15,6 +17,94 @@ namespace std {
     %template(DistanceMatrix) vector<vector<double>>;
 }
 
+// Vectors passed to or returned by the wrapper are Go slices. An input slice
+// is copied into the std::vector with a single range assignment, and a
+// returned vector is copied into a Go slice once, so a bulk array costs one
+// cgo call whatever its length. Declared after the templates above so that
+// DoubleVector and DistanceMatrix keep their element-wise API.
+%define GO_SLICE_VECTOR(CTYPE, GOELEMENT, GOTYPE)
+%typemap(gotype) std::vector<CTYPE>, const std::vector<CTYPE> & "[]GOTYPE"
+%typemap(in) std::vector<CTYPE>
+%{
+  $1 = std::vector<CTYPE>((GOELEMENT *)$input.array,
+                          (GOELEMENT *)$input.array + $input.len);
+%}
+%typemap(in) const std::vector<CTYPE> & (std::vector<CTYPE> temp)
+%{
+  temp.assign((GOELEMENT *)$input.array,
+              (GOELEMENT *)$input.array + $input.len);
+  $1 = &temp;
+%}
+%enddef
+
+%define GO_SLICE_VECTOR_OUT(CTYPE, GOTYPE)
+// $1 may be a SwigValueWrapper, whose operator& yields the vector.
+%typemap(out) std::vector<CTYPE>
+%{
+  $result.len = (intgo)(&$1)->size();
+  $result.cap = $result.len;
+  $result.array = NULL;
+  if ($result.len > 0) {
+    $result.array = malloc($result.len * sizeof(CTYPE));
+    memcpy($result.array, (&$1)->data(), $result.len * sizeof(CTYPE));
+  }
+%}
+%typemap(goout) std::vector<CTYPE>
+%{
+  $result = make([]GOTYPE, len($1))
+  copy($result, $1)
+  if len($1) > 0 {
+    Swig_free(uintptr(unsafe.Pointer(&$1[0])))
+  }
+%}
+%enddef
+
+GO_SLICE_VECTOR(int64_t, int64_t, int64)
+GO_SLICE_VECTOR(double, double, float64)
+GO_SLICE_VECTOR(int, intgo, int)
+GO_SLICE_VECTOR_OUT(int64_t, int64)
+GO_SLICE_VECTOR_OUT(double, float64)
+
+// Export buffers are Go byte slices written in place by the exporters.
+%typemap(gotype) (char *buffer, int64_t capacity) "[]byte"
+%typemap(in) (char *buffer, int64_t capacity)
+%{
+  $1 = (char *)$input.array;
+  $2 = (int64_t)$input.len;
+%}
+
+// The solve request is read straight from the Go byte slice, without the
+// copy a string conversion would make.
+%typemap(gotype) (const char *request, int64_t size) "[]byte"
+%typemap(in) (const char *request, int64_t size)
+%{
+  $1 = (char *)$input.array;
+  $2 = (int64_t)$input.len;
+%}
+
+// Go passes DataModel around whole and fills it through RoutingWrapper, so
+// its fields, several of C++-only types, stay out of the bindings.
+%rename("$ignore", regextarget=1, fullname=1) "^constraint_solver::DataModel::[a-z_]+$";
+%ignore constraint_solver::DataModel::ArcProfile;
+// Go reaches the one-shot solve through SolveBuffer; the struct API is for
+// C++ callers.
+%ignore constraint_solver::ProblemSpec;
+%ignore constraint_solver::SolveOptions;
+%ignore constraint_solver::SolveResult;
+%ignore constraint_solver::Solve;
+// Features and rules are plain structs; the free functions take C++-only
+// types and are reached through RoutingWrapper.
+%ignore constraint_solver::ComputeInstanceFeatures;
+%ignore constraint_solver::DefaultSearchRules;
+%ignore constraint_solver::LoadSearchRules;
+%ignore constraint_solver::MatchSearchRule;
+%ignore constraint_solver::ParseFirstSolutionStrategy;
+%ignore constraint_solver::ParseLocalSearchMetaheuristic;
+%include "auto_config.h"
+%include "constraint_solver.h"
+%include "solve.h"
+%include "rolling_horizon.h"
+
 
 %insert(cgo_comment_typedefs) %{
 #cgo LDFLAGS: -L../lib -lortools
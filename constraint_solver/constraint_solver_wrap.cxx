@@ -230,7 +230,20 @@ static void* Swig_malloc(int c) {
 }
 
 
+
+static _gostring_ Swig_AllocateString(const char *p, size_t l) {
+  _gostring_ ret;
+  ret.p = (char*)malloc(l);
+  memcpy(ret.p, p, l);
+  ret.n = l;
+  return ret;
+}
+
+
 #include "constraint_solver.h"
+#include "solve.h"
+#include "rolling_horizon.h"
+#include "auto_config.h"
 
 
 #include <string>
@@ -239,6 +252,9 @@ static void* Swig_malloc(int c) {
 #include <vector>
 #include <stdexcept>
 
+
+#include <stdint.h>		// Use the C99 official header
+
 SWIGINTERN std::vector< double >::const_reference std_vector_Sl_double_Sg__get(std::vector< double > *self,int i){
                 int size = int(self->size());
                 if (i>=0 && i<size)
@@ -271,341 +287,2232 @@ SWIGINTERN void std_vector_Sl_std_vector_Sl_double_Sg__Sg__set(std::vector< std:
 extern "C" {
 #endif
 
-void _wrap_Swig_free_constraint_solver_095582e9481db22a(void *_swig_go_0) {
-  void *arg1 = (void *) 0 ;
+void _wrap_Swig_free_constraint_solver_095582e9481db22a(void *_swig_go_0) {
+  void *arg1 = (void *) 0 ;
+  
+  arg1 = *(void **)&_swig_go_0; 
+  
+  Swig_free(arg1);
+  
+}
+
+
+void *_wrap_Swig_malloc_constraint_solver_095582e9481db22a(intgo _swig_go_0) {
+  int arg1 ;
+  void *result = 0 ;
+  void *_swig_go_result;
+  
+  arg1 = (int)_swig_go_0; 
+  
+  result = (void *)Swig_malloc(arg1);
+  *(void **)&_swig_go_result = (void *)result; 
+  return _swig_go_result;
+}
+
+
+std::vector< double > *_wrap_new_DoubleVector__SWIG_0_constraint_solver_095582e9481db22a() {
+  std::vector< double > *result = 0 ;
+  std::vector< double > *_swig_go_result;
+  
+  
+  result = (std::vector< double > *)new std::vector< double >();
+  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
+  return _swig_go_result;
+}
+
+
+std::vector< double > *_wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(long long _swig_go_0) {
+  std::vector< double >::size_type arg1 ;
+  std::vector< double > *result = 0 ;
+  std::vector< double > *_swig_go_result;
+  
+  arg1 = (size_t)_swig_go_0; 
+  
+  result = (std::vector< double > *)new std::vector< double >(arg1);
+  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
+  return _swig_go_result;
+}
+
+
+std::vector< double > *_wrap_new_DoubleVector__SWIG_2_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = 0 ;
+  std::vector< double > *result = 0 ;
+  std::vector< double > *_swig_go_result;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  result = (std::vector< double > *)new std::vector< double >((std::vector< double > const &)*arg1);
+  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_DoubleVector_size_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  std::vector< double >::size_type result;
+  long long _swig_go_result;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  result = ((std::vector< double > const *)arg1)->size();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_DoubleVector_capacity_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  std::vector< double >::size_type result;
+  long long _swig_go_result;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  result = ((std::vector< double > const *)arg1)->capacity();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, long long _swig_go_1) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  std::vector< double >::size_type arg2 ;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg2 = (size_t)_swig_go_1; 
+  
+  (arg1)->reserve(arg2);
+  
+}
+
+
+bool _wrap_DoubleVector_isEmpty_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  result = (bool)((std::vector< double > const *)arg1)->empty();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DoubleVector_clear_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  (arg1)->clear();
+  
+}
+
+
+void _wrap_DoubleVector_add_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, double _swig_go_1) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  std::vector< double >::value_type *arg2 = 0 ;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg2 = (std::vector< double >::value_type *)&_swig_go_1; 
+  
+  (arg1)->push_back((std::vector< double >::value_type const &)*arg2);
+  
+}
+
+
+double _wrap_DoubleVector_get_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, intgo _swig_go_1) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  int arg2 ;
+  std::vector< double >::value_type *result = 0 ;
+  double _swig_go_result;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  try {
+    result = (std::vector< double >::value_type *) &std_vector_Sl_double_Sg__get(arg1,arg2);
+  } catch(std::out_of_range &_e) {
+    (void)_e;
+    _swig_gopanic("C++ std::out_of_range exception thrown");
+    
+  }
+  _swig_go_result = (double)*result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DoubleVector_set_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, intgo _swig_go_1, double _swig_go_2) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  int arg2 ;
+  std::vector< double >::value_type *arg3 = 0 ;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (std::vector< double >::value_type *)&_swig_go_2; 
+  
+  try {
+    std_vector_Sl_double_Sg__set(arg1,arg2,(double const &)*arg3);
+  } catch(std::out_of_range &_e) {
+    (void)_e;
+    _swig_gopanic("C++ std::out_of_range exception thrown");
+    
+  }
+  
+}
+
+
+void _wrap_delete_DoubleVector_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
+  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
+  
+  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_0_constraint_solver_095582e9481db22a() {
+  std::vector< std::vector< double > > *result = 0 ;
+  std::vector< std::vector< double > > *_swig_go_result;
+  
+  
+  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >();
+  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  return _swig_go_result;
+}
+
+
+std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(long long _swig_go_0) {
+  std::vector< std::vector< double > >::size_type arg1 ;
+  std::vector< std::vector< double > > *result = 0 ;
+  std::vector< std::vector< double > > *_swig_go_result;
+  
+  arg1 = (size_t)_swig_go_0; 
+  
+  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >(arg1);
+  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  return _swig_go_result;
+}
+
+
+std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_2_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = 0 ;
+  std::vector< std::vector< double > > *result = 0 ;
+  std::vector< std::vector< double > > *_swig_go_result;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >((std::vector< std::vector< double > > const &)*arg1);
+  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_DistanceMatrix_size_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  std::vector< std::vector< double > >::size_type result;
+  long long _swig_go_result;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  result = ((std::vector< std::vector< double > > const *)arg1)->size();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_DistanceMatrix_capacity_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  std::vector< std::vector< double > >::size_type result;
+  long long _swig_go_result;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  result = ((std::vector< std::vector< double > > const *)arg1)->capacity();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, long long _swig_go_1) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  std::vector< std::vector< double > >::size_type arg2 ;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg2 = (size_t)_swig_go_1; 
+  
+  (arg1)->reserve(arg2);
+  
+}
+
+
+bool _wrap_DistanceMatrix_isEmpty_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  result = (bool)((std::vector< std::vector< double > > const *)arg1)->empty();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DistanceMatrix_clear_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  (arg1)->clear();
+  
+}
+
+
+void _wrap_DistanceMatrix_add_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, std::vector< double > *_swig_go_1) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  std::vector< std::vector< double > >::value_type *arg2 = 0 ;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg2 = *(std::vector< std::vector< double > >::value_type **)&_swig_go_1; 
+  
+  (arg1)->push_back((std::vector< std::vector< double > >::value_type const &)*arg2);
+  
+}
+
+
+std::vector< double > *_wrap_DistanceMatrix_get_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, intgo _swig_go_1) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  int arg2 ;
+  std::vector< std::vector< double > >::value_type *result = 0 ;
+  std::vector< double > *_swig_go_result;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  try {
+    result = (std::vector< std::vector< double > >::value_type *) &std_vector_Sl_std_vector_Sl_double_Sg__Sg__get(arg1,arg2);
+  } catch(std::out_of_range &_e) {
+    (void)_e;
+    _swig_gopanic("C++ std::out_of_range exception thrown");
+    
+  }
+  *(std::vector< std::vector< double > >::value_type **)&_swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_DistanceMatrix_set_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, intgo _swig_go_1, std::vector< double > *_swig_go_2) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  int arg2 ;
+  std::vector< std::vector< double > >::value_type *arg3 = 0 ;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = *(std::vector< std::vector< double > >::value_type **)&_swig_go_2; 
+  
+  try {
+    std_vector_Sl_std_vector_Sl_double_Sg__Sg__set(arg1,arg2,(std::vector< double > const &)*arg3);
+  } catch(std::out_of_range &_e) {
+    (void)_e;
+    _swig_gopanic("C++ std::out_of_range exception thrown");
+    
+  }
+  
+}
+
+
+void _wrap_delete_DistanceMatrix_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
+  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+  
+  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+void _wrap_InstanceFeatures_num_nodes_set_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->num_nodes = arg2;
+  
+}
+
+
+intgo _wrap_InstanceFeatures_num_nodes_get_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  result = (int) ((arg1)->num_nodes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_InstanceFeatures_num_vehicles_set_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->num_vehicles = arg2;
+  
+}
+
+
+intgo _wrap_InstanceFeatures_num_vehicles_get_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  result = (int) ((arg1)->num_vehicles);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_InstanceFeatures_capacity_tightness_set_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0, double _swig_go_1) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->capacity_tightness = arg2;
+  
+}
+
+
+double _wrap_InstanceFeatures_capacity_tightness_get_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->capacity_tightness);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_InstanceFeatures_clustering_set_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0, double _swig_go_1) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->clustering = arg2;
+  
+}
+
+
+double _wrap_InstanceFeatures_clustering_get_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->clustering);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_InstanceFeatures_asymmetry_set_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0, double _swig_go_1) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->asymmetry = arg2;
+  
+}
+
+
+double _wrap_InstanceFeatures_asymmetry_get_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->asymmetry);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::InstanceFeatures *_wrap_new_InstanceFeatures_constraint_solver_095582e9481db22a() {
+  constraint_solver::InstanceFeatures *result = 0 ;
+  constraint_solver::InstanceFeatures *_swig_go_result;
+  
+  
+  result = (constraint_solver::InstanceFeatures *)new constraint_solver::InstanceFeatures();
+  *(constraint_solver::InstanceFeatures **)&_swig_go_result = (constraint_solver::InstanceFeatures *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_InstanceFeatures_constraint_solver_095582e9481db22a(constraint_solver::InstanceFeatures *_swig_go_0) {
+  constraint_solver::InstanceFeatures *arg1 = (constraint_solver::InstanceFeatures *) 0 ;
+  
+  arg1 = *(constraint_solver::InstanceFeatures **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+void _wrap_SearchRule_min_nodes_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->min_nodes = arg2;
+  
+}
+
+
+intgo _wrap_SearchRule_min_nodes_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (int) ((arg1)->min_nodes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_max_nodes_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->max_nodes = arg2;
+  
+}
+
+
+intgo _wrap_SearchRule_max_nodes_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (int) ((arg1)->max_nodes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_min_tightness_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->min_tightness = arg2;
+  
+}
+
+
+double _wrap_SearchRule_min_tightness_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->min_tightness);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_max_tightness_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->max_tightness = arg2;
+  
+}
+
+
+double _wrap_SearchRule_max_tightness_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->max_tightness);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_min_clustering_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->min_clustering = arg2;
+  
+}
+
+
+double _wrap_SearchRule_min_clustering_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->min_clustering);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_max_clustering_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->max_clustering = arg2;
+  
+}
+
+
+double _wrap_SearchRule_max_clustering_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->max_clustering);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_min_asymmetry_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->min_asymmetry = arg2;
+  
+}
+
+
+double _wrap_SearchRule_min_asymmetry_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->min_asymmetry);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_max_asymmetry_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->max_asymmetry = arg2;
+  
+}
+
+
+double _wrap_SearchRule_max_asymmetry_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->max_asymmetry);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_first_solution_strategy_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  if (arg1) (arg1)->first_solution_strategy = *arg2;
+  
+}
+
+
+_gostring_ _wrap_SearchRule_first_solution_strategy_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  std::string *result = 0 ;
+  _gostring_ _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (std::string *) & ((arg1)->first_solution_strategy);
+  _swig_go_result = Swig_AllocateString((*result).data(), (*result).length()); 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_metaheuristic_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  if (arg1) (arg1)->metaheuristic = *arg2;
+  
+}
+
+
+_gostring_ _wrap_SearchRule_metaheuristic_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  std::string *result = 0 ;
+  _gostring_ _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (std::string *) & ((arg1)->metaheuristic);
+  _swig_go_result = Swig_AllocateString((*result).data(), (*result).length()); 
+  return _swig_go_result;
+}
+
+
+void _wrap_SearchRule_search_time_fraction_set_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0, double _swig_go_1) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double arg2 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  
+  if (arg1) (arg1)->search_time_fraction = arg2;
+  
+}
+
+
+double _wrap_SearchRule_search_time_fraction_get_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  double result;
+  double _swig_go_result;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  result = (double) ((arg1)->search_time_fraction);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::SearchRule *_wrap_new_SearchRule_constraint_solver_095582e9481db22a() {
+  constraint_solver::SearchRule *result = 0 ;
+  constraint_solver::SearchRule *_swig_go_result;
+  
+  
+  result = (constraint_solver::SearchRule *)new constraint_solver::SearchRule();
+  *(constraint_solver::SearchRule **)&_swig_go_result = (constraint_solver::SearchRule *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_SearchRule_constraint_solver_095582e9481db22a(constraint_solver::SearchRule *_swig_go_0) {
+  constraint_solver::SearchRule *arg1 = (constraint_solver::SearchRule *) 0 ;
+  
+  arg1 = *(constraint_solver::SearchRule **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+long long _wrap_DataModel_ServiceTime_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+  int arg2 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  result = (int64_t)((constraint_solver::DataModel const *)arg1)->ServiceTime(arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_DataModel_Distance_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2) {
+  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
+  
+  result = (int64_t)((constraint_solver::DataModel const *)arg1)->Distance(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::DataModel *_wrap_new_DataModel_constraint_solver_095582e9481db22a() {
+  constraint_solver::DataModel *result = 0 ;
+  constraint_solver::DataModel *_swig_go_result;
+  
+  
+  result = (constraint_solver::DataModel *)new constraint_solver::DataModel();
+  *(constraint_solver::DataModel **)&_swig_go_result = (constraint_solver::DataModel *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_DataModel_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
+  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+  
+  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+void _wrap_MemoryEstimate_matrix_bytes_set_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->matrix_bytes = arg2;
+  
+}
+
+
+long long _wrap_MemoryEstimate_matrix_bytes_get_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->matrix_bytes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_MemoryEstimate_index_manager_bytes_set_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->index_manager_bytes = arg2;
+  
+}
+
+
+long long _wrap_MemoryEstimate_index_manager_bytes_get_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->index_manager_bytes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_MemoryEstimate_model_bytes_set_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->model_bytes = arg2;
+  
+}
+
+
+long long _wrap_MemoryEstimate_model_bytes_get_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->model_bytes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_MemoryEstimate_search_bytes_set_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->search_bytes = arg2;
+  
+}
+
+
+long long _wrap_MemoryEstimate_search_bytes_get_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->search_bytes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_MemoryEstimate_total_bytes_set_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->total_bytes = arg2;
+  
+}
+
+
+long long _wrap_MemoryEstimate_total_bytes_get_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->total_bytes);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::MemoryEstimate *_wrap_new_MemoryEstimate_constraint_solver_095582e9481db22a() {
+  constraint_solver::MemoryEstimate *result = 0 ;
+  constraint_solver::MemoryEstimate *_swig_go_result;
+  
+  
+  result = (constraint_solver::MemoryEstimate *)new constraint_solver::MemoryEstimate();
+  *(constraint_solver::MemoryEstimate **)&_swig_go_result = (constraint_solver::MemoryEstimate *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_MemoryEstimate_constraint_solver_095582e9481db22a(constraint_solver::MemoryEstimate *_swig_go_0) {
+  constraint_solver::MemoryEstimate *arg1 = (constraint_solver::MemoryEstimate *) 0 ;
+  
+  arg1 = *(constraint_solver::MemoryEstimate **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+void _wrap_LowerBound_objective_set_constraint_solver_095582e9481db22a(constraint_solver::LowerBound *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::LowerBound *arg1 = (constraint_solver::LowerBound *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::LowerBound **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->objective = arg2;
+  
+}
+
+
+long long _wrap_LowerBound_objective_get_constraint_solver_095582e9481db22a(constraint_solver::LowerBound *_swig_go_0) {
+  constraint_solver::LowerBound *arg1 = (constraint_solver::LowerBound *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::LowerBound **)&_swig_go_0; 
+  
+  result = (int64_t) ((arg1)->objective);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_LowerBound_min_vehicles_set_constraint_solver_095582e9481db22a(constraint_solver::LowerBound *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::LowerBound *arg1 = (constraint_solver::LowerBound *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::LowerBound **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->min_vehicles = arg2;
+  
+}
+
+
+intgo _wrap_LowerBound_min_vehicles_get_constraint_solver_095582e9481db22a(constraint_solver::LowerBound *_swig_go_0) {
+  constraint_solver::LowerBound *arg1 = (constraint_solver::LowerBound *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::LowerBound **)&_swig_go_0; 
+  
+  result = (int) ((arg1)->min_vehicles);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::LowerBound *_wrap_new_LowerBound_constraint_solver_095582e9481db22a() {
+  constraint_solver::LowerBound *result = 0 ;
+  constraint_solver::LowerBound *_swig_go_result;
+  
+  
+  result = (constraint_solver::LowerBound *)new constraint_solver::LowerBound();
+  *(constraint_solver::LowerBound **)&_swig_go_result = (constraint_solver::LowerBound *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_LowerBound_constraint_solver_095582e9481db22a(constraint_solver::LowerBound *_swig_go_0) {
+  constraint_solver::LowerBound *arg1 = (constraint_solver::LowerBound *) 0 ;
+  
+  arg1 = *(constraint_solver::LowerBound **)&_swig_go_0; 
+  
+  delete arg1;
+  
+}
+
+
+_gostring_ _wrap_SolveBuffer_constraint_solver_095582e9481db22a(_goslice_ _swig_go_0) {
+  char *arg1 = (char *) 0 ;
+  int64_t arg2 ;
+  std::string result;
+  _gostring_ _swig_go_result;
+  
+  
+  arg1 = (char *)_swig_go_0.array;
+  arg2 = (int64_t)_swig_go_0.len;
+  
+  
+  result = constraint_solver::SolveBuffer((char const *)arg1,arg2);
+  _swig_go_result = Swig_AllocateString(result.data(), result.length()); 
+  return _swig_go_result;
+}
+
+
+constraint_solver::RoutingWrapper *_wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a() {
+  constraint_solver::RoutingWrapper *result = 0 ;
+  constraint_solver::RoutingWrapper *_swig_go_result;
+  
+  
+  result = (constraint_solver::RoutingWrapper *)new constraint_solver::RoutingWrapper();
+  *(constraint_solver::RoutingWrapper **)&_swig_go_result = (constraint_solver::RoutingWrapper *)result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, std::vector< std::vector< double > > * _swig_go_1, intgo _swig_go_2, intgo _swig_go_3) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::vector< std::vector< double > > arg2 ;
+  std::vector< std::vector< double > > *argp2 ;
+  int arg3 ;
+  int arg4 ;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  argp2 = (std::vector< std::vector< double > > *)_swig_go_1;
+  if (argp2 == NULL) {
+    _swig_gopanic("Attempt to dereference null std::vector< std::vector< double > >");
+  }
+  arg2 = (std::vector< std::vector< double > >)*argp2;
+  
+  arg3 = (int)_swig_go_2; 
+  arg4 = (int)_swig_go_3; 
+  
+  (arg1)->InitDataModel(arg2,arg3,arg4);
+  
+}
+
+
+bool _wrap_RoutingWrapper_InitFlatDataModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, intgo _swig_go_2, intgo _swig_go_3, intgo _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  arg3 = (int)_swig_go_2; 
+  arg4 = (int)_swig_go_3; 
+  arg5 = (int)_swig_go_4; 
+  
+  result = (bool)(arg1)->InitFlatDataModel(arg2,arg3,arg4,arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_InitRoadGraphDataModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, _goslice_ _swig_go_2, intgo _swig_go_3, intgo _swig_go_4, intgo _swig_go_5) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  int arg4 ;
+  int arg5 ;
+  int arg6 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  arg4 = (int)_swig_go_3; 
+  arg5 = (int)_swig_go_4; 
+  arg6 = (int)_swig_go_5; 
+  
+  result = (bool)(arg1)->InitRoadGraphDataModel((std::string const &)*arg2,arg3,arg4,arg5,arg6);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_InitRoadGraphMatrixDataModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, _goslice_ _swig_go_2, intgo _swig_go_3, intgo _swig_go_4, intgo _swig_go_5) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  int arg4 ;
+  int arg5 ;
+  int arg6 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  arg4 = (int)_swig_go_3; 
+  arg5 = (int)_swig_go_4; 
+  arg6 = (int)_swig_go_5; 
+  
+  result = (bool)(arg1)->InitRoadGraphMatrixDataModel((std::string const &)*arg2,arg3,arg4,arg5,arg6);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetVehicleStartsAndEnds_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->SetVehicleStartsAndEnds(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::DataModel *_wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  constraint_solver::DataModel result;
+  constraint_solver::DataModel *_swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  result = (arg1)->getData();
+  *(constraint_solver::DataModel **)&_swig_go_result = new constraint_solver::DataModel(result); 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetVehicleClasses_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2, _goslice_ _swig_go_3, _goslice_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  std::vector< double > arg3 ;
+  std::vector< double > arg4 ;
+  SwigValueWrapper< std::vector< int64_t > > arg5 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<double>((double *)_swig_go_2.array,
+                          (double *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  arg4 = std::vector<double>((double *)_swig_go_3.array,
+                          (double *)_swig_go_3.array + _swig_go_3.len);
+  
+  
+  arg5 = std::vector<int64_t>((int64_t *)_swig_go_4.array,
+                          (int64_t *)_swig_go_4.array + _swig_go_4.len);
+  
+  
+  result = (bool)(arg1)->SetVehicleClasses(arg2,arg3,arg4,arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, constraint_solver::DataModel * _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  constraint_solver::DataModel arg2 ;
+  constraint_solver::DataModel *argp2 ;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  argp2 = (constraint_solver::DataModel *)_swig_go_1;
+  if (argp2 == NULL) {
+    _swig_gopanic("Attempt to dereference null constraint_solver::DataModel");
+  }
+  arg2 = (constraint_solver::DataModel)*argp2;
+  
+  
+  (arg1)->CreateRoutingIndexManager(arg2);
+  
+}
+
+
+void _wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  (arg1)->CreateRoutingModel();
+  
+}
+
+
+void _wrap_RoutingWrapper_CreateRoutingModelFromData_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  (arg1)->CreateRoutingModelFromData();
+  
+}
+
+
+intgo _wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  result = (int)(arg1)->RegisterTransitCallback();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetDemands_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->SetDemands(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddCapacityDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  result = (bool)(arg1)->AddCapacityDimension((std::string const &)*arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetServiceTimes_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  result = (bool)(arg1)->SetServiceTimes(arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddTimeDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1, long long _swig_go_2, bool _swig_go_3, _gostring_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
+  int64_t arg3 ;
+  bool arg4 ;
+  std::string *arg5 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  arg3 = (int64_t)_swig_go_2; 
+  arg4 = (bool)_swig_go_3; 
+  
+  std::string arg5_str(_swig_go_4.p, _swig_go_4.n);
+  arg5 = &arg5_str;
+  
+  
+  result = (bool)(arg1)->AddTimeDimension(arg2,arg3,arg4,(std::string const &)*arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+intgo _wrap_RoutingWrapper_AggregateColocatedStops_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  result = (int)(arg1)->AggregateColocatedStops();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+_goslice_ _wrap_RoutingWrapper_GetNodeGroups_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > result;
+  _goslice_ _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  result = (arg1)->GetNodeGroups();
+  
+  _swig_go_result.len = (intgo)(&result)->size();
+  _swig_go_result.cap = _swig_go_result.len;
+  _swig_go_result.array = NULL;
+  if (_swig_go_result.len > 0) {
+    _swig_go_result.array = malloc(_swig_go_result.len * sizeof(int64_t));
+    memcpy(_swig_go_result.array, (&result)->data(), _swig_go_result.len * sizeof(int64_t));
+  }
+  
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddVehicleClassTimeDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1, long long _swig_go_2, bool _swig_go_3, _gostring_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
+  int64_t arg3 ;
+  bool arg4 ;
+  std::string *arg5 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  arg3 = (int64_t)_swig_go_2; 
+  arg4 = (bool)_swig_go_3; 
+  
+  std::string arg5_str(_swig_go_4.p, _swig_go_4.n);
+  arg5 = &arg5_str;
+  
+  
+  result = (bool)(arg1)->AddVehicleClassTimeDimension(arg2,arg3,arg4,(std::string const &)*arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+intgo _wrap_RoutingWrapper_AddTravelTimeProfile_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  std::vector< double > arg3 ;
+  int result;
+  intgo _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<double>((double *)_swig_go_2.array,
+                          (double *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (int)(arg1)->AddTravelTimeProfile(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetTravelTimeZones_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->SetTravelTimeZones(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddTimeDependentDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1, long long _swig_go_2, bool _swig_go_3, _gostring_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
+  int64_t arg3 ;
+  bool arg4 ;
+  std::string *arg5 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  arg3 = (int64_t)_swig_go_2; 
+  arg4 = (bool)_swig_go_3; 
+  
+  std::string arg5_str(_swig_go_4.p, _swig_go_4.n);
+  arg5 = &arg5_str;
+  
+  
+  result = (bool)(arg1)->AddTimeDependentDimension(arg2,arg3,arg4,(std::string const &)*arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2, intgo _swig_go_3, bool _swig_go_4, _gostring_ _swig_go_5) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  int arg4 ;
+  bool arg5 ;
+  std::string *arg6 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
+  arg4 = (int)_swig_go_3; 
+  arg5 = (bool)_swig_go_4; 
+  
+  std::string arg6_str(_swig_go_5.p, _swig_go_5.n);
+  arg6 = &arg6_str;
+  
+  
+  result = (bool)(arg1)->AddDimension(arg2,arg3,arg4,arg5,(std::string const &)*arg6);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, long long _swig_go_2, _goslice_ _swig_go_3, bool _swig_go_4, _gostring_ _swig_go_5) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int arg2 ;
+  int64_t arg3 ;
+  SwigValueWrapper< std::vector< int64_t > > arg4 ;
+  bool arg5 ;
+  std::string *arg6 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int64_t)_swig_go_2; 
+  
+  arg4 = std::vector<int64_t>((int64_t *)_swig_go_3.array,
+                          (int64_t *)_swig_go_3.array + _swig_go_3.len);
+  
+  arg5 = (bool)_swig_go_4; 
+  
+  std::string arg6_str(_swig_go_5.p, _swig_go_5.n);
+  arg6 = &arg6_str;
+  
+  
+  result = (bool)(arg1)->AddDimensionWithVehicleCapacity(arg2,arg3,arg4,arg5,(std::string const &)*arg6);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetGlobalSpanCostCoefficient_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, long long _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  int64_t arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  arg3 = (int64_t)_swig_go_2; 
+  
+  result = (bool)(arg1)->SetGlobalSpanCostCoefficient((std::string const &)*arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetSpanUpperBounds_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->SetSpanUpperBounds((std::string const &)*arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetCumulSoftUpperBounds_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, _goslice_ _swig_go_2, _goslice_ _swig_go_3, _goslice_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  SwigValueWrapper< std::vector< int64_t > > arg4 ;
+  SwigValueWrapper< std::vector< int64_t > > arg5 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  arg4 = std::vector<int64_t>((int64_t *)_swig_go_3.array,
+                          (int64_t *)_swig_go_3.array + _swig_go_3.len);
+  
+  
+  arg5 = std::vector<int64_t>((int64_t *)_swig_go_4.array,
+                          (int64_t *)_swig_go_4.array + _swig_go_4.len);
+  
+  
+  result = (bool)(arg1)->SetCumulSoftUpperBounds((std::string const &)*arg2,arg3,arg4,arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetRouteEndSoftUpperBounds_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1, _goslice_ _swig_go_2, _goslice_ _swig_go_3) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  SwigValueWrapper< std::vector< int64_t > > arg4 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  arg4 = std::vector<int64_t>((int64_t *)_swig_go_3.array,
+                          (int64_t *)_swig_go_3.array + _swig_go_3.len);
+  
+  
+  result = (bool)(arg1)->SetRouteEndSoftUpperBounds((std::string const &)*arg2,arg3,arg4);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddPickupsAndDeliveries_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2, _gostring_ _swig_go_3) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  std::string *arg4 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  std::string arg4_str(_swig_go_3.p, _swig_go_3.n);
+  arg4 = &arg4_str;
+  
+  
+  result = (bool)(arg1)->AddPickupsAndDeliveries(arg2,arg3,(std::string const &)*arg4);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_SetDropPenalties_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  result = (bool)(arg1)->SetDropPenalties(arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_AddDisjunctionGroups_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2, _goslice_ _swig_go_3, _goslice_ _swig_go_4) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  SwigValueWrapper< std::vector< int64_t > > arg4 ;
+  SwigValueWrapper< std::vector< int64_t > > arg5 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  arg4 = std::vector<int64_t>((int64_t *)_swig_go_3.array,
+                          (int64_t *)_swig_go_3.array + _swig_go_3.len);
+  
+  
+  arg5 = std::vector<int64_t>((int64_t *)_swig_go_4.array,
+                          (int64_t *)_swig_go_4.array + _swig_go_4.len);
+  
+  
+  result = (bool)(arg1)->AddDisjunctionGroups(arg2,arg3,arg4,arg5);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_ApplyRouteLocks_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->ApplyRouteLocks(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
   
-  arg1 = *(void **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  Swig_free(arg1);
+  (arg1)->CreateDefaultRoutingSearchParameters();
   
 }
 
 
-void *_wrap_Swig_malloc_constraint_solver_095582e9481db22a(intgo _swig_go_0) {
-  int arg1 ;
-  void *result = 0 ;
-  void *_swig_go_result;
+void _wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string arg2 ;
   
-  arg1 = (int)_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  (&arg2)->assign(_swig_go_1.p, _swig_go_1.n); 
+  
+  (arg1)->SetFirstSolutionStrategy(arg2);
   
-  result = (void *)Swig_malloc(arg1);
-  *(void **)&_swig_go_result = (void *)result; 
-  return _swig_go_result;
 }
 
 
-void _wrap_DataModel_distance_matrix_set_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, std::vector< std::vector< double > > *_swig_go_1) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  std::vector< std::vector< double > > *arg2 = (std::vector< std::vector< double > > *) 0 ;
+void _wrap_RoutingWrapper_SetLocalSearchMetaheuristic_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string arg2 ;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
-  arg2 = *(std::vector< std::vector< double > > **)&_swig_go_1; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  (&arg2)->assign(_swig_go_1.p, _swig_go_1.n); 
   
-  if (arg1) (arg1)->distance_matrix = *arg2;
+  (arg1)->SetLocalSearchMetaheuristic(arg2);
   
 }
 
 
-std::vector< std::vector< double > > *_wrap_DataModel_distance_matrix_get_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  std::vector< std::vector< double > > *result = 0 ;
-  std::vector< std::vector< double > > *_swig_go_result;
+void _wrap_RoutingWrapper_SetTimeLimit_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
   
-  result = (std::vector< std::vector< double > > *)& ((arg1)->distance_matrix);
-  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  (arg1)->SetTimeLimit(arg2);
+  
+}
+
+
+constraint_solver::InstanceFeatures *_wrap_RoutingWrapper_GetInstanceFeatures_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  constraint_solver::InstanceFeatures result;
+  constraint_solver::InstanceFeatures *_swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  result = (arg1)->GetInstanceFeatures();
+  *(constraint_solver::InstanceFeatures **)&_swig_go_result = new constraint_solver::InstanceFeatures(result); 
   return _swig_go_result;
 }
 
 
-void _wrap_DataModel_num_vehicles_set_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, intgo _swig_go_1) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+bool _wrap_RoutingWrapper_LoadSearchRules_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  std::string *arg2 = 0 ;
+  bool result;
+  bool _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  result = (bool)(arg1)->LoadSearchRules((std::string const &)*arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+constraint_solver::SearchRule *_wrap_RoutingWrapper_GetSearchRule_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
   int arg2 ;
+  constraint_solver::SearchRule result;
+  constraint_solver::SearchRule *_swig_go_result;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   arg2 = (int)_swig_go_1; 
   
-  if (arg1) (arg1)->num_vehicles = arg2;
-  
+  result = (arg1)->GetSearchRule(arg2);
+  *(constraint_solver::SearchRule **)&_swig_go_result = new constraint_solver::SearchRule(result); 
+  return _swig_go_result;
 }
 
 
-intgo _wrap_DataModel_num_vehicles_get_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+intgo _wrap_RoutingWrapper_AutoConfigure_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
   int result;
   intgo _swig_go_result;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
   
-  result = (int) ((arg1)->num_vehicles);
+  result = (int)(arg1)->AutoConfigure(arg2);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_DataModel_depot_set_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, operations_research::RoutingIndexManager::NodeIndex *_swig_go_1) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  operations_research::RoutingIndexManager::NodeIndex arg2 ;
-  operations_research::RoutingIndexManager::NodeIndex *argp2 ;
-  
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
-  
-  argp2 = (operations_research::RoutingIndexManager::NodeIndex *)_swig_go_1;
-  if (argp2 == NULL) {
-    _swig_gopanic("Attempt to dereference null operations_research::RoutingIndexManager::NodeIndex");
-  }
-  arg2 = (operations_research::RoutingIndexManager::NodeIndex)*argp2;
-  
+bool _wrap_RoutingWrapper_SolveAutoConfigured_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1, intgo _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
+  int arg3 ;
+  bool result;
+  bool _swig_go_result;
   
-  if (arg1) (arg1)->depot = arg2;
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
   
+  result = (bool)(arg1)->SolveAutoConfigured(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-operations_research::RoutingIndexManager::NodeIndex *_wrap_DataModel_depot_get_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  operations_research::RoutingIndexManager::NodeIndex result;
-  operations_research::RoutingIndexManager::NodeIndex *_swig_go_result;
+bool _wrap_RoutingWrapper_SetDeterministicMode_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, long long _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int32_t arg2 ;
+  int64_t arg3 ;
+  bool result;
+  bool _swig_go_result;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int32_t)_swig_go_1; 
+  arg3 = (int64_t)_swig_go_2; 
   
-  result =  ((arg1)->depot);
-  *(operations_research::RoutingIndexManager::NodeIndex **)&_swig_go_result = new operations_research::RoutingIndexManager::NodeIndex(result); 
+  result = (bool)(arg1)->SetDeterministicMode(arg2,arg3);
+  _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_DataModel_vehicle_capacities_set_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0, std::vector< int64_t > *_swig_go_1) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  std::vector< int64_t > *arg2 = (std::vector< int64_t > *) 0 ;
+void _wrap_RoutingWrapper_SetMemoryBudget_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, long long _swig_go_1, bool _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int64_t arg2 ;
+  bool arg3 ;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
-  arg2 = *(std::vector< int64_t > **)&_swig_go_1; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  arg3 = (bool)_swig_go_2; 
   
-  if (arg1) (arg1)->vehicle_capacities = *arg2;
+  (arg1)->SetMemoryBudget(arg2,arg3);
   
 }
 
 
-std::vector< int64_t > *_wrap_DataModel_vehicle_capacities_get_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
-  std::vector< int64_t > *result = 0 ;
-  std::vector< int64_t > *_swig_go_result;
+constraint_solver::MemoryEstimate *_wrap_RoutingWrapper_EstimateMemory_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  constraint_solver::MemoryEstimate result;
+  constraint_solver::MemoryEstimate *_swig_go_result;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  result = (std::vector< int64_t > *)& ((arg1)->vehicle_capacities);
-  *(std::vector< int64_t > **)&_swig_go_result = (std::vector< int64_t > *)result; 
+  result = (arg1)->EstimateMemory();
+  *(constraint_solver::MemoryEstimate **)&_swig_go_result = new constraint_solver::MemoryEstimate(result); 
   return _swig_go_result;
 }
 
 
-constraint_solver::DataModel *_wrap_new_DataModel_constraint_solver_095582e9481db22a() {
-  constraint_solver::DataModel *result = 0 ;
-  constraint_solver::DataModel *_swig_go_result;
+constraint_solver::LowerBound *_wrap_RoutingWrapper_ComputeLowerBound_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int arg2 ;
+  constraint_solver::LowerBound result;
+  constraint_solver::LowerBound *_swig_go_result;
   
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
   
-  result = (constraint_solver::DataModel *)new constraint_solver::DataModel();
-  *(constraint_solver::DataModel **)&_swig_go_result = (constraint_solver::DataModel *)result; 
+  result = (arg1)->ComputeLowerBound(arg2);
+  *(constraint_solver::LowerBound **)&_swig_go_result = new constraint_solver::LowerBound(result); 
   return _swig_go_result;
 }
 
 
-void _wrap_delete_DataModel_constraint_solver_095582e9481db22a(constraint_solver::DataModel *_swig_go_0) {
-  constraint_solver::DataModel *arg1 = (constraint_solver::DataModel *) 0 ;
+void _wrap_RoutingWrapper_SetEarlyStopGap_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, double _swig_go_1, intgo _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  double arg2 ;
+  int arg3 ;
   
-  arg1 = *(constraint_solver::DataModel **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (double)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
   
-  delete arg1;
+  (arg1)->SetEarlyStopGap(arg2,arg3);
   
 }
 
 
-constraint_solver::RoutingWrapper *_wrap_new_RoutingWrapper_constraint_solver_095582e9481db22a() {
-  constraint_solver::RoutingWrapper *result = 0 ;
-  constraint_solver::RoutingWrapper *_swig_go_result;
+bool _wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  bool result;
+  bool _swig_go_result;
   
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  result = (constraint_solver::RoutingWrapper *)new constraint_solver::RoutingWrapper();
-  *(constraint_solver::RoutingWrapper **)&_swig_go_result = (constraint_solver::RoutingWrapper *)result; 
+  result = (bool)(arg1)->SolveWithCurrentParameters();
+  _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_InitDataModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, std::vector< std::vector< double > > *_swig_go_1, intgo _swig_go_2, intgo _swig_go_3) {
+_gostring_ _wrap_RoutingWrapper_GetReplayLog_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  std::vector< std::vector< double > > arg2 ;
-  int arg3 ;
-  int arg4 ;
-  std::vector< std::vector< double > > *argp2 ;
+  std::string result;
+  _gostring_ _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  argp2 = (std::vector< std::vector< double > > *)_swig_go_1;
-  if (argp2 == NULL) {
-    _swig_gopanic("Attempt to dereference null std::vector< std::vector< double > >");
-  }
-  arg2 = (std::vector< std::vector< double > >)*argp2;
-  
-  arg3 = (int)_swig_go_2; 
-  arg4 = (int)_swig_go_3; 
+  result = (arg1)->GetReplayLog();
+  _swig_go_result = Swig_AllocateString(result.data(), result.length()); 
+  return _swig_go_result;
+}
+
+
+bool _wrap_RoutingWrapper_HasSolution_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  bool result;
+  bool _swig_go_result;
   
-  (arg1)->InitDataModel(arg2,arg3,arg4);
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
+  result = (bool)(arg1)->HasSolution();
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-constraint_solver::DataModel *_wrap_RoutingWrapper_getData_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+long long _wrap_RoutingWrapper_GetObjectiveValue_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  constraint_solver::DataModel result;
-  constraint_solver::DataModel *_swig_go_result;
+  int64_t result;
+  long long _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  result = (arg1)->getData();
-  *(constraint_solver::DataModel **)&_swig_go_result = new constraint_solver::DataModel(result); 
+  result = (int64_t)(arg1)->GetObjectiveValue();
+  _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_CreateRoutingIndexManager_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, constraint_solver::DataModel *_swig_go_1) {
+_goslice_ _wrap_RoutingWrapper_GetRoute_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  constraint_solver::DataModel arg2 ;
-  constraint_solver::DataModel *argp2 ;
+  int arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > result;
+  _goslice_ _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
   
-  argp2 = (constraint_solver::DataModel *)_swig_go_1;
-  if (argp2 == NULL) {
-    _swig_gopanic("Attempt to dereference null constraint_solver::DataModel");
-  }
-  arg2 = (constraint_solver::DataModel)*argp2;
-  
+  result = (arg1)->GetRoute(arg2);
   
-  (arg1)->CreateRoutingIndexManager(arg2);
+  _swig_go_result.len = (intgo)(&result)->size();
+  _swig_go_result.cap = _swig_go_result.len;
+  _swig_go_result.array = NULL;
+  if (_swig_go_result.len > 0) {
+    _swig_go_result.array = malloc(_swig_go_result.len * sizeof(int64_t));
+    memcpy(_swig_go_result.array, (&result)->data(), _swig_go_result.len * sizeof(int64_t));
+  }
   
+  return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_CreateRoutingModel_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+_goslice_ _wrap_RoutingWrapper_GetDroppedNodes_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > result;
+  _goslice_ _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  (arg1)->CreateRoutingModel();
+  result = (arg1)->GetDroppedNodes();
+  
+  _swig_go_result.len = (intgo)(&result)->size();
+  _swig_go_result.cap = _swig_go_result.len;
+  _swig_go_result.array = NULL;
+  if (_swig_go_result.len > 0) {
+    _swig_go_result.array = malloc(_swig_go_result.len * sizeof(int64_t));
+    memcpy(_swig_go_result.array, (&result)->data(), _swig_go_result.len * sizeof(int64_t));
+  }
   
+  return _swig_go_result;
 }
 
 
-intgo _wrap_RoutingWrapper_RegisterTransitCallback_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+bool _wrap_RoutingWrapper_ImproveRoutesAfterSolve_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  int result;
-  intgo _swig_go_result;
+  int arg2 ;
+  int arg3 ;
+  bool result;
+  bool _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
   
-  result = (int)(arg1)->RegisterTransitCallback();
+  result = (bool)(arg1)->ImproveRoutesAfterSolve(arg2,arg3);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-bool _wrap_RoutingWrapper_AddDimension_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2, intgo _swig_go_3, bool _swig_go_4, _gostring_ _swig_go_5) {
+bool _wrap_RoutingWrapper_ImproveWithRuinAndRecreate_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2, intgo _swig_go_3) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
   int arg2 ;
   int arg3 ;
-  int arg4 ;
-  bool arg5 ;
-  std::string *arg6 = 0 ;
+  int32_t arg4 ;
   bool result;
   bool _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   arg2 = (int)_swig_go_1; 
   arg3 = (int)_swig_go_2; 
-  arg4 = (int)_swig_go_3; 
-  arg5 = (bool)_swig_go_4; 
-  
-  std::string arg6_str(_swig_go_5.p, _swig_go_5.n);
-  arg6 = &arg6_str;
-  
+  arg4 = (int32_t)_swig_go_3; 
   
-  result = (bool)(arg1)->AddDimension(arg2,arg3,arg4,arg5,(std::string const &)*arg6);
+  result = (bool)(arg1)->ImproveWithRuinAndRecreate(arg2,arg3,arg4);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-bool _wrap_RoutingWrapper_AddDimensionWithVehicleCapacity_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, int64_t *_swig_go_2, std::vector< int64_t > *_swig_go_3, bool _swig_go_4, _gostring_ _swig_go_5) {
+bool _wrap_RoutingWrapper_SetNodeCoordinates_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  int arg2 ;
-  int64_t arg3 ;
-  SwigValueWrapper< std::vector< int64_t > > arg4 ;
-  bool arg5 ;
-  std::string *arg6 = 0 ;
-  int64_t *argp3 ;
-  std::vector< int64_t > *argp4 ;
+  std::vector< double > arg2 ;
+  std::vector< double > arg3 ;
   bool result;
   bool _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
-  arg2 = (int)_swig_go_1; 
   
-  argp3 = (int64_t *)_swig_go_2;
-  if (argp3 == NULL) {
-    _swig_gopanic("Attempt to dereference null int64_t");
-  }
-  arg3 = (int64_t)*argp3;
+  arg2 = std::vector<double>((double *)_swig_go_1.array,
+                          (double *)_swig_go_1.array + _swig_go_1.len);
   
   
-  argp4 = (std::vector< int64_t > *)_swig_go_3;
-  if (argp4 == NULL) {
-    _swig_gopanic("Attempt to dereference null std::vector< int64_t >");
-  }
-  arg4 = (std::vector< int64_t >)*argp4;
+  arg3 = std::vector<double>((double *)_swig_go_2.array,
+                          (double *)_swig_go_2.array + _swig_go_2.len);
   
-  arg5 = (bool)_swig_go_4; 
   
-  std::string arg6_str(_swig_go_5.p, _swig_go_5.n);
-  arg6 = &arg6_str;
+  result = (bool)(arg1)->SetNodeCoordinates(arg2,arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_RoutingWrapper_ExportBinaryToBuffer_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _gostring_ _swig_go_2) {
+  constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int64_t arg3 ;
+  std::string *arg4 = 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
   
-  result = (bool)(arg1)->AddDimensionWithVehicleCapacity(arg2,arg3,arg4,arg5,(std::string const &)*arg6);
+  arg2 = (char *)_swig_go_1.array;
+  arg3 = (int64_t)_swig_go_1.len;
+  
+  
+  std::string arg4_str(_swig_go_2.p, _swig_go_2.n);
+  arg4 = &arg4_str;
+  
+  
+  result = (int64_t)(arg1)->ExportBinaryToBuffer(arg2,arg3,(std::string const &)*arg4);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_CreateDefaultRoutingSearchParameters_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+long long _wrap_RoutingWrapper_ExportBinaryToFd_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, _gostring_ _swig_go_2) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int arg2 ;
+  std::string *arg3 = 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  std::string arg3_str(_swig_go_2.p, _swig_go_2.n);
+  arg3 = &arg3_str;
   
-  (arg1)->CreateDefaultRoutingSearchParameters();
   
+  result = (int64_t)(arg1)->ExportBinaryToFd(arg2,(std::string const &)*arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_SetFirstSolutionStrategy_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _gostring_ _swig_go_1) {
+long long _wrap_RoutingWrapper_ExportGeoJsonToBuffer_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, _goslice_ _swig_go_1, _gostring_ _swig_go_2) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
-  std::string arg2 ;
+  char *arg2 = (char *) 0 ;
+  int64_t arg3 ;
+  std::string *arg4 = 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
   arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
-  (&arg2)->assign(_swig_go_1.p, _swig_go_1.n); 
   
-  (arg1)->SetFirstSolutionStrategy(arg2);
+  arg2 = (char *)_swig_go_1.array;
+  arg3 = (int64_t)_swig_go_1.len;
+  
+  
+  std::string arg4_str(_swig_go_2.p, _swig_go_2.n);
+  arg4 = &arg4_str;
   
+  
+  result = (int64_t)(arg1)->ExportGeoJsonToBuffer(arg2,arg3,(std::string const &)*arg4);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-void _wrap_RoutingWrapper_SolveWithCurrentParameters_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0) {
+long long _wrap_RoutingWrapper_ExportGeoJsonToFd_constraint_solver_095582e9481db22a(constraint_solver::RoutingWrapper *_swig_go_0, intgo _swig_go_1, _gostring_ _swig_go_2) {
   constraint_solver::RoutingWrapper *arg1 = (constraint_solver::RoutingWrapper *) 0 ;
+  int arg2 ;
+  std::string *arg3 = 0 ;
+  int64_t result;
+  long long _swig_go_result;
+  
+  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
   
-  arg1 = *(constraint_solver::RoutingWrapper **)&_swig_go_0; 
+  std::string arg3_str(_swig_go_2.p, _swig_go_2.n);
+  arg3 = &arg3_str;
   
-  (arg1)->SolveWithCurrentParameters();
   
+  result = (int64_t)(arg1)->ExportGeoJsonToFd(arg2,(std::string const &)*arg3);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
@@ -629,322 +2536,377 @@ void _wrap_delete_RoutingWrapper_constraint_solver_095582e9481db22a(constraint_s
 }
 
 
-std::vector< double > *_wrap_new_DoubleVector__SWIG_0_constraint_solver_095582e9481db22a() {
-  std::vector< double > *result = 0 ;
-  std::vector< double > *_swig_go_result;
+void _wrap_RollingHorizonOptions_max_batch_orders_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int arg2 ;
+  
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
   
+  if (arg1) (arg1)->max_batch_orders = arg2;
   
-  result = (std::vector< double > *)new std::vector< double >();
-  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
-  return _swig_go_result;
 }
 
 
-std::vector< double > *_wrap_new_DoubleVector__SWIG_1_constraint_solver_095582e9481db22a(long long _swig_go_0) {
-  std::vector< double >::size_type arg1 ;
-  std::vector< double > *result = 0 ;
-  std::vector< double > *_swig_go_result;
+intgo _wrap_RollingHorizonOptions_max_batch_orders_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int result;
+  intgo _swig_go_result;
   
-  arg1 = (size_t)_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  result = (std::vector< double > *)new std::vector< double >(arg1);
-  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
+  result = (int) ((arg1)->max_batch_orders);
+  _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-std::vector< double > *_wrap_new_DoubleVector__SWIG_2_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = 0 ;
-  std::vector< double > *result = 0 ;
-  std::vector< double > *_swig_go_result;
+void _wrap_RollingHorizonOptions_locked_visits_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int arg2 ;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  
+  if (arg1) (arg1)->locked_visits = arg2;
   
-  result = (std::vector< double > *)new std::vector< double >((std::vector< double > const &)*arg1);
-  *(std::vector< double > **)&_swig_go_result = (std::vector< double > *)result; 
-  return _swig_go_result;
 }
 
 
-long long _wrap_DoubleVector_size_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  std::vector< double >::size_type result;
-  long long _swig_go_result;
+intgo _wrap_RollingHorizonOptions_locked_visits_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int result;
+  intgo _swig_go_result;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  result = ((std::vector< double > const *)arg1)->size();
+  result = (int) ((arg1)->locked_visits);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-long long _wrap_DoubleVector_capacity_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  std::vector< double >::size_type result;
+void _wrap_RollingHorizonOptions_time_limit_ms_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int64_t arg2 ;
+  
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
+  
+  if (arg1) (arg1)->time_limit_ms = arg2;
+  
+}
+
+
+long long _wrap_RollingHorizonOptions_time_limit_ms_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int64_t result;
   long long _swig_go_result;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  result = ((std::vector< double > const *)arg1)->capacity();
+  result = (int64_t) ((arg1)->time_limit_ms);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_DoubleVector_reserve_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, long long _swig_go_1) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  std::vector< double >::size_type arg2 ;
+void _wrap_RollingHorizonOptions_first_solution_strategy_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  std::string *arg2 = 0 ;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
-  arg2 = (size_t)_swig_go_1; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  (arg1)->reserve(arg2);
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
+  
+  
+  if (arg1) (arg1)->first_solution_strategy = *arg2;
   
 }
 
 
-bool _wrap_DoubleVector_isEmpty_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  bool result;
-  bool _swig_go_result;
+_gostring_ _wrap_RollingHorizonOptions_first_solution_strategy_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  std::string *result = 0 ;
+  _gostring_ _swig_go_result;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  result = (bool)((std::vector< double > const *)arg1)->empty();
-  _swig_go_result = result; 
+  result = (std::string *) & ((arg1)->first_solution_strategy);
+  _swig_go_result = Swig_AllocateString((*result).data(), (*result).length()); 
   return _swig_go_result;
 }
 
 
-void _wrap_DoubleVector_clear_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+void _wrap_RollingHorizonOptions_metaheuristic_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, _gostring_ _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  std::string *arg2 = 0 ;
   
-  (arg1)->clear();
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-}
-
-
-void _wrap_DoubleVector_add_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, double _swig_go_1) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  std::vector< double >::value_type *arg2 = 0 ;
+  std::string arg2_str(_swig_go_1.p, _swig_go_1.n);
+  arg2 = &arg2_str;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
-  arg2 = (std::vector< double >::value_type *)&_swig_go_1; 
   
-  (arg1)->push_back((std::vector< double >::value_type const &)*arg2);
+  if (arg1) (arg1)->metaheuristic = *arg2;
   
 }
 
 
-double _wrap_DoubleVector_get_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, intgo _swig_go_1) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  int arg2 ;
-  std::vector< double >::value_type *result = 0 ;
-  double _swig_go_result;
+_gostring_ _wrap_RollingHorizonOptions_metaheuristic_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  std::string *result = 0 ;
+  _gostring_ _swig_go_result;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
-  arg2 = (int)_swig_go_1; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
-  try {
-    result = (std::vector< double >::value_type *) &std_vector_Sl_double_Sg__get(arg1,arg2);
-  } catch(std::out_of_range &_e) {
-    (void)_e;
-    _swig_gopanic("C++ std::out_of_range exception thrown");
-    
-  }
-  _swig_go_result = (double)*result; 
+  result = (std::string *) & ((arg1)->metaheuristic);
+  _swig_go_result = Swig_AllocateString((*result).data(), (*result).length()); 
   return _swig_go_result;
 }
 
 
-void _wrap_DoubleVector_set_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0, intgo _swig_go_1, double _swig_go_2) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  int arg2 ;
-  std::vector< double >::value_type *arg3 = 0 ;
+void _wrap_RollingHorizonOptions_drop_penalty_set_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int64_t arg2 ;
   
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
-  arg2 = (int)_swig_go_1; 
-  arg3 = (std::vector< double >::value_type *)&_swig_go_2; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
   
-  try {
-    std_vector_Sl_double_Sg__set(arg1,arg2,(double const &)*arg3);
-  } catch(std::out_of_range &_e) {
-    (void)_e;
-    _swig_gopanic("C++ std::out_of_range exception thrown");
-    
-  }
+  if (arg1) (arg1)->drop_penalty = arg2;
   
 }
 
 
-void _wrap_delete_DoubleVector_constraint_solver_095582e9481db22a(std::vector< double > *_swig_go_0) {
-  std::vector< double > *arg1 = (std::vector< double > *) 0 ;
-  
-  arg1 = *(std::vector< double > **)&_swig_go_0; 
+long long _wrap_RollingHorizonOptions_drop_penalty_get_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
-  delete arg1;
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
   
+  result = (int64_t) ((arg1)->drop_penalty);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_0_constraint_solver_095582e9481db22a() {
-  std::vector< std::vector< double > > *result = 0 ;
-  std::vector< std::vector< double > > *_swig_go_result;
+constraint_solver::RollingHorizonOptions *_wrap_new_RollingHorizonOptions_constraint_solver_095582e9481db22a() {
+  constraint_solver::RollingHorizonOptions *result = 0 ;
+  constraint_solver::RollingHorizonOptions *_swig_go_result;
   
   
-  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >();
-  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  result = (constraint_solver::RollingHorizonOptions *)new constraint_solver::RollingHorizonOptions();
+  *(constraint_solver::RollingHorizonOptions **)&_swig_go_result = (constraint_solver::RollingHorizonOptions *)result; 
   return _swig_go_result;
 }
 
 
-std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_1_constraint_solver_095582e9481db22a(long long _swig_go_0) {
-  std::vector< std::vector< double > >::size_type arg1 ;
-  std::vector< std::vector< double > > *result = 0 ;
-  std::vector< std::vector< double > > *_swig_go_result;
+void _wrap_delete_RollingHorizonOptions_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonOptions *_swig_go_0) {
+  constraint_solver::RollingHorizonOptions *arg1 = (constraint_solver::RollingHorizonOptions *) 0 ;
   
-  arg1 = (size_t)_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_0; 
+  
+  delete arg1;
   
-  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >(arg1);
-  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
-  return _swig_go_result;
 }
 
 
-std::vector< std::vector< double > > *_wrap_new_DistanceMatrix__SWIG_2_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = 0 ;
-  std::vector< std::vector< double > > *result = 0 ;
-  std::vector< std::vector< double > > *_swig_go_result;
+constraint_solver::RollingHorizonPlanner *_wrap_new_RollingHorizonPlanner_constraint_solver_095582e9481db22a(_goslice_ _swig_go_0, intgo _swig_go_1, intgo _swig_go_2, intgo _swig_go_3, constraint_solver::RollingHorizonOptions * _swig_go_4) {
+  SwigValueWrapper< std::vector< int64_t > > arg1 ;
+  int arg2 ;
+  int arg3 ;
+  int arg4 ;
+  constraint_solver::RollingHorizonOptions *arg5 = 0 ;
+  constraint_solver::RollingHorizonPlanner *result = 0 ;
+  constraint_solver::RollingHorizonPlanner *_swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
   
-  result = (std::vector< std::vector< double > > *)new std::vector< std::vector< double > >((std::vector< std::vector< double > > const &)*arg1);
-  *(std::vector< std::vector< double > > **)&_swig_go_result = (std::vector< std::vector< double > > *)result; 
+  arg1 = std::vector<int64_t>((int64_t *)_swig_go_0.array,
+                          (int64_t *)_swig_go_0.array + _swig_go_0.len);
+  
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
+  arg4 = (int)_swig_go_3; 
+  arg5 = *(constraint_solver::RollingHorizonOptions **)&_swig_go_4; 
+  
+  result = (constraint_solver::RollingHorizonPlanner *)new constraint_solver::RollingHorizonPlanner(arg1,arg2,arg3,arg4,(constraint_solver::RollingHorizonOptions const &)*arg5);
+  *(constraint_solver::RollingHorizonPlanner **)&_swig_go_result = (constraint_solver::RollingHorizonPlanner *)result; 
   return _swig_go_result;
 }
 
 
-long long _wrap_DistanceMatrix_size_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  std::vector< std::vector< double > >::size_type result;
-  long long _swig_go_result;
+bool _wrap_RollingHorizonPlanner_IsValid_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  bool result;
+  bool _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   
-  result = ((std::vector< std::vector< double > > const *)arg1)->size();
+  result = (bool)((constraint_solver::RollingHorizonPlanner const *)arg1)->IsValid();
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-long long _wrap_DistanceMatrix_capacity_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  std::vector< std::vector< double > >::size_type result;
-  long long _swig_go_result;
+bool _wrap_RollingHorizonPlanner_SetDemands_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0, _goslice_ _swig_go_1, _goslice_ _swig_go_2) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  SwigValueWrapper< std::vector< int64_t > > arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > arg3 ;
+  bool result;
+  bool _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   
-  result = ((std::vector< std::vector< double > > const *)arg1)->capacity();
+  arg2 = std::vector<int64_t>((int64_t *)_swig_go_1.array,
+                          (int64_t *)_swig_go_1.array + _swig_go_1.len);
+  
+  
+  arg3 = std::vector<int64_t>((int64_t *)_swig_go_2.array,
+                          (int64_t *)_swig_go_2.array + _swig_go_2.len);
+  
+  
+  result = (bool)(arg1)->SetDemands(arg2,arg3);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_DistanceMatrix_reserve_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, long long _swig_go_1) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  std::vector< std::vector< double > >::size_type arg2 ;
-  
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
-  arg2 = (size_t)_swig_go_1; 
+bool _wrap_RollingHorizonPlanner_QueueOrder_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0, long long _swig_go_1) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int64_t arg2 ;
+  bool result;
+  bool _swig_go_result;
   
-  (arg1)->reserve(arg2);
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
+  arg2 = (int64_t)_swig_go_1; 
   
+  result = (bool)(arg1)->QueueOrder(arg2);
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-bool _wrap_DistanceMatrix_isEmpty_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+bool _wrap_RollingHorizonPlanner_CommitVisits_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0, intgo _swig_go_1, intgo _swig_go_2) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int arg2 ;
+  int arg3 ;
   bool result;
   bool _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
+  arg3 = (int)_swig_go_2; 
   
-  result = (bool)((std::vector< std::vector< double > > const *)arg1)->empty();
+  result = (bool)(arg1)->CommitVisits(arg2,arg3);
   _swig_go_result = result; 
   return _swig_go_result;
 }
 
 
-void _wrap_DistanceMatrix_clear_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+bool _wrap_RollingHorizonPlanner_ProcessBatch_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  bool result;
+  bool _swig_go_result;
   
-  (arg1)->clear();
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   
+  result = (bool)(arg1)->ProcessBatch();
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-void _wrap_DistanceMatrix_add_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, std::vector< double > *_swig_go_1) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  std::vector< std::vector< double > >::value_type *arg2 = 0 ;
+_goslice_ _wrap_RollingHorizonPlanner_GetCommittedVisits_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int arg2 ;
+  SwigValueWrapper< std::vector< int64_t > > result;
+  _goslice_ _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
-  arg2 = *(std::vector< std::vector< double > >::value_type **)&_swig_go_1; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
+  arg2 = (int)_swig_go_1; 
   
-  (arg1)->push_back((std::vector< std::vector< double > >::value_type const &)*arg2);
+  result = ((constraint_solver::RollingHorizonPlanner const *)arg1)->GetCommittedVisits(arg2);
   
+  _swig_go_result.len = (intgo)(&result)->size();
+  _swig_go_result.cap = _swig_go_result.len;
+  _swig_go_result.array = NULL;
+  if (_swig_go_result.len > 0) {
+    _swig_go_result.array = malloc(_swig_go_result.len * sizeof(int64_t));
+    memcpy(_swig_go_result.array, (&result)->data(), _swig_go_result.len * sizeof(int64_t));
+  }
+  
+  return _swig_go_result;
 }
 
 
-std::vector< double > *_wrap_DistanceMatrix_get_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, intgo _swig_go_1) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+_goslice_ _wrap_RollingHorizonPlanner_GetOpenVisits_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0, intgo _swig_go_1) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
   int arg2 ;
-  std::vector< std::vector< double > >::value_type *result = 0 ;
-  std::vector< double > *_swig_go_result;
+  SwigValueWrapper< std::vector< int64_t > > result;
+  _goslice_ _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   arg2 = (int)_swig_go_1; 
   
-  try {
-    result = (std::vector< std::vector< double > >::value_type *) &std_vector_Sl_std_vector_Sl_double_Sg__Sg__get(arg1,arg2);
-  } catch(std::out_of_range &_e) {
-    (void)_e;
-    _swig_gopanic("C++ std::out_of_range exception thrown");
-    
+  result = ((constraint_solver::RollingHorizonPlanner const *)arg1)->GetOpenVisits(arg2);
+  
+  _swig_go_result.len = (intgo)(&result)->size();
+  _swig_go_result.cap = _swig_go_result.len;
+  _swig_go_result.array = NULL;
+  if (_swig_go_result.len > 0) {
+    _swig_go_result.array = malloc(_swig_go_result.len * sizeof(int64_t));
+    memcpy(_swig_go_result.array, (&result)->data(), _swig_go_result.len * sizeof(int64_t));
   }
-  *(std::vector< std::vector< double > >::value_type **)&_swig_go_result = result; 
+  
   return _swig_go_result;
 }
 
 
-void _wrap_DistanceMatrix_set_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0, intgo _swig_go_1, std::vector< double > *_swig_go_2) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
-  int arg2 ;
-  std::vector< std::vector< double > >::value_type *arg3 = 0 ;
+long long _wrap_RollingHorizonPlanner_GetQueuedOrders_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
-  arg2 = (int)_swig_go_1; 
-  arg3 = *(std::vector< std::vector< double > >::value_type **)&_swig_go_2; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   
-  try {
-    std_vector_Sl_std_vector_Sl_double_Sg__Sg__set(arg1,arg2,(std::vector< double > const &)*arg3);
-  } catch(std::out_of_range &_e) {
-    (void)_e;
-    _swig_gopanic("C++ std::out_of_range exception thrown");
-    
-  }
+  result = (int64_t)((constraint_solver::RollingHorizonPlanner const *)arg1)->GetQueuedOrders();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+long long _wrap_RollingHorizonPlanner_GetLastModelSize_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
+  
+  result = (int64_t)((constraint_solver::RollingHorizonPlanner const *)arg1)->GetLastModelSize();
+  _swig_go_result = result; 
+  return _swig_go_result;
 }
 
 
-void _wrap_delete_DistanceMatrix_constraint_solver_095582e9481db22a(std::vector< std::vector< double > > *_swig_go_0) {
-  std::vector< std::vector< double > > *arg1 = (std::vector< std::vector< double > > *) 0 ;
+long long _wrap_RollingHorizonPlanner_GetLastBatchMs_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  int64_t result;
+  long long _swig_go_result;
   
-  arg1 = *(std::vector< std::vector< double > > **)&_swig_go_0; 
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
+  
+  result = (int64_t)((constraint_solver::RollingHorizonPlanner const *)arg1)->GetLastBatchMs();
+  _swig_go_result = result; 
+  return _swig_go_result;
+}
+
+
+void _wrap_delete_RollingHorizonPlanner_constraint_solver_095582e9481db22a(constraint_solver::RollingHorizonPlanner *_swig_go_0) {
+  constraint_solver::RollingHorizonPlanner *arg1 = (constraint_solver::RollingHorizonPlanner *) 0 ;
+  
+  arg1 = *(constraint_solver::RollingHorizonPlanner **)&_swig_go_0; 
   
   delete arg1;
   
@@ -0,0 +1,91 @@
+#ifndef FLAT_MATRIX_H
+#define FLAT_MATRIX_H
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace constraint_solver {
+// Row-major square matrix of the integral arc values the routing callbacks
+// return. One contiguous buffer, so a lookup is a single load and worker
+// threads can share it read-only. Compact() halves it by switching to 32-bit
+// storage when every value fits.
+class FlatMatrix {
+public:
+  FlatMatrix() = default;
+  explicit FlatMatrix(const std::vector<std::vector<double>> &matrix) {
+    Resize(matrix.size());
+    for (int from = 0; from < num_nodes; ++from) {
+      int64_t *row = Row(from);
+      for (int to = 0; to < num_nodes; ++to) {
+        row[to] = matrix[from][to];
+      }
+    }
+  }
+
+  // Takes ownership of size * size row-major values.
+  FlatMatrix(int size, std::vector<int64_t> row_major_values)
+      : num_nodes(size), values(std::move(row_major_values)) {}
+
+  void Resize(int size) {
+    num_nodes = size;
+    values.assign(static_cast<size_t>(size) * size, 0);
+    std::vector<int32_t>().swap(compact_values);
+  }
+
+  // Lookup for either storage. Hot paths that know the storage, like the
+  // routing callbacks, use Wide or Narrow so they do not branch on it.
+  int64_t operator()(int from, int to) const {
+    return compact() ? Narrow(from, to) : Wide(from, to);
+  }
+  // Only valid before Compact().
+  int64_t Wide(int from, int to) const { return values[Offset(from, to)]; }
+  // Only valid after a successful Compact().
+  int64_t Narrow(int from, int to) const {
+    return compact_values[Offset(from, to)];
+  }
+
+  // Switches to 32-bit storage. Returns false, leaving the matrix unchanged,
+  // if a value does not fit.
+  bool Compact() {
+    if (values.empty()) {
+      return !compact_values.empty();
+    }
+    for (int64_t value : values) {
+      if (value < std::numeric_limits<int32_t>::min() ||
+          value > std::numeric_limits<int32_t>::max()) {
+        return false;
+      }
+    }
+    compact_values.assign(values.begin(), values.end());
+    std::vector<int64_t>().swap(values);
+    return true;
+  }
+  bool compact() const { return !compact_values.empty(); }
+  int64_t ByteSize() const {
+    return values.capacity() * sizeof(int64_t) +
+           compact_values.capacity() * sizeof(int32_t);
+  }
+
+  // Direct row access, only valid before Compact().
+  int64_t *Row(int from) {
+    return values.data() + static_cast<size_t>(from) * num_nodes;
+  }
+  const int64_t *Row(int from) const {
+    return values.data() + static_cast<size_t>(from) * num_nodes;
+  }
+  int size() const { return num_nodes; }
+
+private:
+  size_t Offset(int from, int to) const {
+    return static_cast<size_t>(from) * num_nodes + to;
+  }
+
+  int num_nodes = 0;
+  std::vector<int64_t> values;
+  std::vector<int32_t> compact_values;
+};
+} // namespace constraint_solver
+
+#endif
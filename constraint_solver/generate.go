@@ -0,0 +1,6 @@
+package constraint_solver
+
+// constraint_solver.go and constraint_solver_wrap.cxx are generated from
+// constraint_solver.i by SWIG 4.1.1. Run go generate in this directory after
+// changing the interface or a header it includes, and commit both outputs.
+//go:generate swig -go -cgo -c++ -intgosize 64 -o constraint_solver_wrap.cxx -outdir . constraint_solver.i
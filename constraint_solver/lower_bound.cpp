@@ -0,0 +1,245 @@
+#include "lower_bound.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+constexpr int kSubgradientIterations = 100;
+// Halve the step after this many iterations without a better bound.
+constexpr int kIterationsPerStep = 10;
+
+// Evaluates the Lagrangian relaxation for given customer penalties.
+// Customers are addressed by their position in customers, so costs and
+// penalties are plain array lookups.
+class ForestRelaxation {
+public:
+  ForestRelaxation(const FlatMatrix &costs, int depot,
+                   std::vector<int> customers, int min_vehicles,
+                   int max_vehicles)
+      : costs(costs), depot(depot), customers(std::move(customers)),
+        num_customers(this->customers.size()), min_vehicles(min_vehicles),
+        max_vehicles(max_vehicles), in_tree(num_customers), best(num_customers),
+        parent(num_customers), edge_from(num_customers),
+        edge_to(num_customers), edge_weight(num_customers),
+        edge_order(num_customers), depot_weight(num_customers),
+        depot_order(num_customers) {}
+
+  int size() const { return num_customers; }
+
+  // Returns the bound for penalties and the degree of every customer in the
+  // relaxed solution.
+  double Evaluate(const std::vector<double> &penalties,
+                  std::vector<int> *degrees) {
+    // Prim's minimum spanning tree over the customers, O(size^2) without a
+    // heap since the graph is complete.
+    std::fill(in_tree.begin(), in_tree.end(), false);
+    std::fill(best.begin(), best.end(),
+              std::numeric_limits<double>::infinity());
+    best[0] = 0;
+    parent[0] = -1;
+    int num_edges = 0;
+    double tree_weight = 0;
+    for (int step = 0; step < num_customers; ++step) {
+      int next = -1;
+      for (int v = 0; v < num_customers; ++v) {
+        if (!in_tree[v] && (next < 0 || best[v] < best[next])) {
+          next = v;
+        }
+      }
+      in_tree[next] = true;
+      if (parent[next] >= 0) {
+        edge_from[num_edges] = parent[next];
+        edge_to[num_edges] = next;
+        edge_weight[num_edges] = best[next];
+        tree_weight += best[next];
+        ++num_edges;
+      }
+      const int from = customers[next];
+      for (int v = 0; v < num_customers; ++v) {
+        if (in_tree[v]) {
+          continue;
+        }
+        const double weight =
+            costs(from, customers[v]) + penalties[next] + penalties[v];
+        if (weight < best[v]) {
+          best[v] = weight;
+          parent[v] = next;
+        }
+      }
+    }
+    std::iota(edge_order.begin(), edge_order.begin() + num_edges, 0);
+    std::sort(edge_order.begin(), edge_order.begin() + num_edges,
+              [this](int a, int b) { return edge_weight[a] > edge_weight[b]; });
+
+    // Every route leaves and reenters the depot; the cheapest way to add 2m
+    // depot arcs with customer degrees at most 2 is twice the m cheapest.
+    for (int v = 0; v < num_customers; ++v) {
+      depot_weight[v] = costs(depot, customers[v]) + penalties[v];
+    }
+    std::iota(depot_order.begin(), depot_order.end(), 0);
+    std::sort(depot_order.begin(), depot_order.end(), [this](int a, int b) {
+      return depot_weight[a] < depot_weight[b];
+    });
+
+    // With m routes the forest drops the m - 1 heaviest tree edges.
+    const int last = std::min(max_vehicles, num_customers);
+    const int first = std::min(std::max(1, min_vehicles), last);
+    double forest_weight = tree_weight;
+    double depot_arcs = 0;
+    double best_bound = std::numeric_limits<double>::infinity();
+    int best_routes = first;
+    for (int routes = 1; routes <= last; ++routes) {
+      if (routes > 1) {
+        forest_weight -= edge_weight[edge_order[routes - 2]];
+      }
+      depot_arcs += 2 * depot_weight[depot_order[routes - 1]];
+      if (routes >= first && forest_weight + depot_arcs < best_bound) {
+        best_bound = forest_weight + depot_arcs;
+        best_routes = routes;
+      }
+    }
+
+    degrees->assign(num_customers, 0);
+    for (int i = best_routes - 1; i < num_edges; ++i) {
+      ++(*degrees)[edge_from[edge_order[i]]];
+      ++(*degrees)[edge_to[edge_order[i]]];
+    }
+    for (int i = 0; i < best_routes; ++i) {
+      (*degrees)[depot_order[i]] += 2;
+    }
+    return best_bound -
+           2 * std::accumulate(penalties.begin(), penalties.end(), 0.0);
+  }
+
+private:
+  const FlatMatrix &costs;
+  const int depot;
+  const std::vector<int> customers;
+  const int num_customers;
+  const int min_vehicles;
+  const int max_vehicles;
+  std::vector<bool> in_tree;
+  std::vector<double> best;
+  std::vector<int> parent;
+  std::vector<int> edge_from;
+  std::vector<int> edge_to;
+  std::vector<double> edge_weight;
+  std::vector<int> edge_order;
+  std::vector<double> depot_weight;
+  std::vector<int> depot_order;
+};
+
+double SubgradientBound(ForestRelaxation *relaxation, double upper_bound,
+                        double step_scale) {
+  std::vector<double> penalties(relaxation->size(), 0.0);
+  std::vector<int> degrees;
+  double best_bound = -std::numeric_limits<double>::infinity();
+  int stalled = 0;
+  for (int iteration = 0; iteration < kSubgradientIterations; ++iteration) {
+    const double bound = relaxation->Evaluate(penalties, &degrees);
+    if (bound > best_bound) {
+      best_bound = bound;
+      stalled = 0;
+    } else if (++stalled == kIterationsPerStep) {
+      step_scale /= 2;
+      stalled = 0;
+    }
+    double norm = 0;
+    for (int degree : degrees) {
+      norm += (degree - 2) * (degree - 2);
+    }
+    // Every customer has degree 2: the relaxation is a set of routes.
+    if (norm == 0 || bound >= upper_bound) {
+      break;
+    }
+    const double step = step_scale * (upper_bound - bound) / norm;
+    for (size_t i = 0; i < penalties.size(); ++i) {
+      penalties[i] += step * (degrees[i] - 2);
+    }
+  }
+  return best_bound;
+}
+} // namespace
+
+int MinVehiclesForCapacity(const std::vector<int64_t> &demands,
+                           std::vector<int64_t> vehicle_capacities) {
+  int64_t remaining = 0;
+  for (int64_t demand : demands) {
+    remaining += std::max<int64_t>(demand, 0);
+  }
+  std::sort(vehicle_capacities.begin(), vehicle_capacities.end(),
+            std::greater<int64_t>());
+  int vehicles = 0;
+  for (int64_t capacity : vehicle_capacities) {
+    if (remaining <= 0) {
+      break;
+    }
+    remaining -= capacity;
+    ++vehicles;
+  }
+  return remaining <= 0 ? vehicles : -1;
+}
+
+int64_t RouteDistanceLowerBound(const FlatMatrix &matrix, int depot,
+                                int min_vehicles, int max_vehicles,
+                                int64_t upper_bound, int num_threads) {
+  const int num_nodes = matrix.size();
+  if (num_nodes <= 1 || max_vehicles <= 0) {
+    return 0;
+  }
+  // Undirected costs, shared read-only by all runs.
+  FlatMatrix costs;
+  costs.Resize(num_nodes);
+  for (int from = 0; from < num_nodes; ++from) {
+    int64_t *row = costs.Row(from);
+    for (int to = 0; to < num_nodes; ++to) {
+      row[to] = std::min(matrix(from, to), matrix(to, from));
+      if (row[to] < 0) {
+        return 0;
+      }
+    }
+  }
+  costs.Compact();
+
+  std::vector<int> customers;
+  double trivial_upper_bound = 0;
+  for (int node = 0; node < num_nodes; ++node) {
+    if (node != depot) {
+      customers.push_back(node);
+      trivial_upper_bound += 2.0 * matrix(depot, node);
+    }
+  }
+  const double step_upper_bound =
+      upper_bound > 0 ? upper_bound : trivial_upper_bound;
+
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  std::vector<double> bounds(num_threads);
+  auto run = [&](int thread) {
+    ForestRelaxation relaxation(costs, depot, customers, min_vehicles,
+                                max_vehicles);
+    bounds[thread] =
+        SubgradientBound(&relaxation, step_upper_bound, 2.0 / (1 + thread));
+  };
+  std::vector<std::thread> threads;
+  for (int thread = 1; thread < num_threads; ++thread) {
+    threads.emplace_back(run, thread);
+  }
+  run(0);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  const double bound = *std::max_element(bounds.begin(), bounds.end());
+  // Distances are integral, so the bound rounds up; the tolerance absorbs
+  // floating-point error in the penalties.
+  return std::max<int64_t>(0, std::ceil(bound - 1e-9 * std::abs(bound) - 1e-6));
+}
+} // namespace constraint_solver
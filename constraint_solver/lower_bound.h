@@ -0,0 +1,27 @@
+#ifndef LOWER_BOUND_H
+#define LOWER_BOUND_H
+#include <cstdint>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+// Smallest number of vehicles whose capacities can hold the total demand,
+// filling the largest vehicles first. Returns -1 if the whole fleet cannot.
+int MinVehiclesForCapacity(const std::vector<int64_t> &demands,
+                           std::vector<int64_t> vehicle_capacities);
+
+// Lower bound on the total distance of routes that all start and end at
+// depot, use between min_vehicles and max_vehicles vehicles and visit every
+// other node once. Routes are relaxed to a spanning forest over the
+// customers plus two depot arcs per route, with customer degrees dualized
+// (Held-Karp style) on min(d(i, j), d(j, i)). num_threads independent
+// subgradient runs with different step sizes (all cores when <= 0) keep the
+// best bound. upper_bound, e.g. the objective of a known solution, scales
+// the steps. Returns 0 if a distance is negative.
+int64_t RouteDistanceLowerBound(const FlatMatrix &matrix, int depot,
+                                int min_vehicles, int max_vehicles,
+                                int64_t upper_bound, int num_threads);
+} // namespace constraint_solver
+
+#endif
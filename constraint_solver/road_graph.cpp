@@ -0,0 +1,252 @@
+#include "road_graph.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+template <typename T> bool ReadArray(std::ifstream *file, std::vector<T> *out) {
+  return static_cast<bool>(file->read(reinterpret_cast<char *>(out->data()),
+                                      out->size() * sizeof(T)));
+}
+} // namespace
+
+bool RoadGraph::IsValid() const {
+  if (offsets.empty() || offsets.front() != 0 ||
+      offsets.back() != static_cast<int64_t>(targets.size()) ||
+      targets.size() != weights.size()) {
+    return false;
+  }
+  for (size_t vertex = 1; vertex < offsets.size(); ++vertex) {
+    if (offsets[vertex] < offsets[vertex - 1]) {
+      return false;
+    }
+  }
+  const int vertices = num_vertices();
+  for (size_t arc = 0; arc < targets.size(); ++arc) {
+    if (targets[arc] < 0 || targets[arc] >= vertices || weights[arc] < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LoadRoadGraph(const std::string &path, RoadGraph *graph) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const int64_t file_size = file.tellg();
+  file.seekg(0);
+  int64_t header[2];
+  if (!file.read(reinterpret_cast<char *>(header), sizeof(header))) {
+    return false;
+  }
+  const int64_t num_vertices = header[0];
+  const int64_t num_arcs = header[1];
+  // Checked against the file size before allocating anything.
+  if (num_vertices < 0 ||
+      num_vertices >= std::numeric_limits<int32_t>::max() || num_arcs < 0 ||
+      num_arcs > file_size ||
+      static_cast<int64_t>(sizeof(header)) +
+              (num_vertices + 1) * static_cast<int64_t>(sizeof(int64_t)) +
+              num_arcs * static_cast<int64_t>(sizeof(int32_t) +
+                                              sizeof(int64_t)) !=
+          file_size) {
+    return false;
+  }
+  RoadGraph loaded;
+  loaded.offsets.resize(num_vertices + 1);
+  loaded.targets.resize(num_arcs);
+  loaded.weights.resize(num_arcs);
+  if (!ReadArray(&file, &loaded.offsets) ||
+      !ReadArray(&file, &loaded.targets) ||
+      !ReadArray(&file, &loaded.weights) || !loaded.IsValid()) {
+    return false;
+  }
+  *graph = std::move(loaded);
+  return true;
+}
+
+ShortestPathSearch::ShortestPathSearch(const RoadGraph &graph)
+    : graph(graph), distance(graph.num_vertices()),
+      reached(graph.num_vertices(), 0), targeted(graph.num_vertices(), 0) {}
+
+void ShortestPathSearch::Run(int32_t source,
+                             const std::vector<int32_t> &targets,
+                             int64_t *distances) {
+  if (++generation == 0) {
+    std::fill(reached.begin(), reached.end(), 0);
+    std::fill(targeted.begin(), targeted.end(), 0);
+    generation = 1;
+  }
+  int remaining = 0;
+  for (int32_t target : targets) {
+    if (targeted[target] != generation) {
+      targeted[target] = generation;
+      ++remaining;
+    }
+  }
+
+  // Min-heap with lazy deletion: a vertex is pushed again when its distance
+  // improves and stale entries are skipped when popped.
+  const std::greater<std::pair<int64_t, int32_t>> later;
+  heap.clear();
+  distance[source] = 0;
+  reached[source] = generation;
+  heap.emplace_back(0, source);
+  while (!heap.empty() && remaining > 0) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    const auto [vertex_distance, vertex] = heap.back();
+    heap.pop_back();
+    if (vertex_distance > distance[vertex]) {
+      continue;
+    }
+    if (targeted[vertex] == generation) {
+      --remaining;
+    }
+    for (int64_t arc = graph.offsets[vertex]; arc < graph.offsets[vertex + 1];
+         ++arc) {
+      const int32_t next = graph.targets[arc];
+      const int64_t next_distance = vertex_distance + graph.weights[arc];
+      if (reached[next] != generation || next_distance < distance[next]) {
+        reached[next] = generation;
+        distance[next] = next_distance;
+        heap.emplace_back(next_distance, next);
+        std::push_heap(heap.begin(), heap.end(), later);
+      }
+    }
+  }
+  for (size_t i = 0; i < targets.size(); ++i) {
+    distances[i] = reached[targets[i]] == generation ? distance[targets[i]]
+                                                     : kUnreachableDistance;
+  }
+}
+
+void BuildDistanceMatrix(const RoadGraph &graph,
+                         const std::vector<int32_t> &node_vertices,
+                         int num_threads, FlatMatrix *matrix) {
+  const int num_nodes = node_vertices.size();
+  matrix->Resize(num_nodes);
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  num_threads = std::max(1, std::min(num_threads, num_nodes));
+  std::atomic<int> next_source(0);
+  auto worker = [&]() {
+    ShortestPathSearch search(graph);
+    for (int source = next_source++; source < num_nodes;
+         source = next_source++) {
+      search.Run(node_vertices[source], node_vertices, matrix->Row(source));
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+}
+
+LazyDistanceOracle::LazyDistanceOracle(std::shared_ptr<const RoadGraph> graph,
+                                       std::vector<int32_t> node_vertices,
+                                       int max_cached_rows)
+    : graph(std::move(graph)), node_vertices(std::move(node_vertices)),
+      max_cached_rows(std::clamp<int>(max_cached_rows, 1,
+                                      std::max<int>(1, num_nodes()))),
+      search(*this->graph), scratch_row(num_nodes()),
+      slot_rows(this->max_cached_rows), slot_versions(this->max_cached_rows),
+      node_slot(num_nodes()), slot_node(this->max_cached_rows),
+      slot_referenced(this->max_cached_rows) {
+  for (std::atomic<int32_t> &slot : node_slot) {
+    slot.store(-1, std::memory_order_relaxed);
+  }
+}
+
+int64_t LazyDistanceOracle::Distance(int from_node, int to_node) {
+  const int slot = node_slot[from_node].load(std::memory_order_acquire);
+  if (slot >= 0) {
+    const uint32_t version =
+        slot_versions[slot].load(std::memory_order_acquire);
+    if (version % 2 == 0 &&
+        slot_node[slot].load(std::memory_order_relaxed) == from_node) {
+      const int64_t distance =
+          slot_rows[slot][to_node].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot_versions[slot].load(std::memory_order_relaxed) == version) {
+        // Only written when clear, so hits do not bounce the cache line.
+        if (!slot_referenced[slot].load(std::memory_order_relaxed)) {
+          slot_referenced[slot].store(true, std::memory_order_relaxed);
+        }
+        return distance;
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  return ComputeDistance(from_node, to_node);
+}
+
+int64_t LazyDistanceOracle::ComputeDistance(int from_node, int to_node) {
+  // Another thread may have computed the row since the lock-free check.
+  int slot = node_slot[from_node].load(std::memory_order_relaxed);
+  if (slot >= 0) {
+    slot_referenced[slot].store(true, std::memory_order_relaxed);
+    return slot_rows[slot][to_node].load(std::memory_order_relaxed);
+  }
+  const size_t row_size = node_vertices.size();
+  if (used_slots < max_cached_rows) {
+    slot = used_slots++;
+    slot_rows[slot] = std::make_unique<std::atomic<int64_t>[]>(row_size);
+  } else {
+    while (slot_referenced[clock_hand].load(std::memory_order_relaxed)) {
+      slot_referenced[clock_hand].store(false, std::memory_order_relaxed);
+      clock_hand = (clock_hand + 1) % max_cached_rows;
+    }
+    slot = clock_hand;
+    clock_hand = (clock_hand + 1) % max_cached_rows;
+    node_slot[slot_node[slot].load(std::memory_order_relaxed)].store(
+        -1, std::memory_order_relaxed);
+  }
+  search.Run(node_vertices[from_node], node_vertices, scratch_row.data());
+  ++computed;
+
+  // Readers that saw the old row fail their version check.
+  const uint32_t version = slot_versions[slot].load(std::memory_order_relaxed);
+  slot_versions[slot].store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot_node[slot].store(from_node, std::memory_order_relaxed);
+  std::atomic<int64_t> *row = slot_rows[slot].get();
+  for (size_t to = 0; to < row_size; ++to) {
+    row[to].store(scratch_row[to], std::memory_order_relaxed);
+  }
+  slot_versions[slot].store(version + 2, std::memory_order_release);
+  slot_referenced[slot].store(true, std::memory_order_relaxed);
+  node_slot[from_node].store(slot, std::memory_order_release);
+  return scratch_row[to_node];
+}
+
+int64_t LazyDistanceOracle::ByteSize() const {
+  const int64_t vertices = graph->num_vertices();
+  return graph->ByteSize() +
+         static_cast<int64_t>(max_cached_rows) * num_nodes() *
+             sizeof(int64_t) +
+         vertices * (sizeof(int64_t) + 2 * sizeof(uint32_t)) +
+         node_vertices.size() * (sizeof(int32_t) * 2 + sizeof(int64_t));
+}
+
+int64_t LazyDistanceOracle::rows_computed() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return computed;
+}
+} // namespace constraint_solver
@@ -0,0 +1,119 @@
+#ifndef ROAD_GRAPH_H
+#define ROAD_GRAPH_H
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+// Directed road network in compressed sparse row form: the arcs leaving
+// vertex v are targets[offsets[v]..offsets[v + 1]) with the matching weights.
+struct RoadGraph {
+  std::vector<int64_t> offsets;
+  std::vector<int32_t> targets;
+  std::vector<int64_t> weights;
+
+  int num_vertices() const {
+    return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+  }
+  int64_t ByteSize() const {
+    return offsets.capacity() * sizeof(int64_t) +
+           targets.capacity() * sizeof(int32_t) +
+           weights.capacity() * sizeof(int64_t);
+  }
+  // Checks that offsets are non-decreasing, targets exist and weights are
+  // non-negative.
+  bool IsValid() const;
+};
+
+// Reads a graph written as little-endian binary:
+//   int64 num_vertices, int64 num_arcs,
+//   int64 offsets[num_vertices + 1], int32 targets[num_arcs],
+//   int64 weights[num_arcs].
+// Returns false, leaving graph untouched, if the file cannot be read or the
+// graph is invalid.
+bool LoadRoadGraph(const std::string &path, RoadGraph *graph);
+
+// Distance returned for vertices that cannot be reached. Large enough to
+// never be chosen, small enough that routes summing a few of them do not
+// overflow the cumuls.
+constexpr int64_t kUnreachableDistance = int64_t{1} << 40;
+
+// One-to-many Dijkstra whose per-vertex state is reset by generation stamps,
+// so repeated searches on the same graph only touch the vertices they visit
+// and reuse the heap storage.
+class ShortestPathSearch {
+public:
+  explicit ShortestPathSearch(const RoadGraph &graph);
+
+  // Writes the distance from source to targets[i] into distances[i]. The
+  // search stops as soon as every target is settled.
+  void Run(int32_t source, const std::vector<int32_t> &targets,
+           int64_t *distances);
+
+private:
+  const RoadGraph &graph;
+  std::vector<int64_t> distance;
+  std::vector<uint32_t> reached;
+  std::vector<uint32_t> targeted;
+  uint32_t generation = 0;
+  std::vector<std::pair<int64_t, int32_t>> heap;
+};
+
+// Fills matrix with the distances between all node_vertices, one search per
+// source spread over num_threads threads (all cores when <= 0). Every thread
+// reuses one ShortestPathSearch and writes its rows straight into the matrix
+// buffer.
+void BuildDistanceMatrix(const RoadGraph &graph,
+                         const std::vector<int32_t> &node_vertices,
+                         int num_threads, FlatMatrix *matrix);
+
+// Distances between routing nodes computed from a road graph on demand. The
+// row of a node is computed by one early-stopping Dijkstra the first time an
+// arc leaving it is queried, then kept in a cache of at most max_cached_rows
+// rows evicted in clock (second chance) order. Thread-safe. Cache hits take
+// no lock: every slot has a version, odd while its row is rewritten, and a
+// read is kept only if the version was even and unchanged around it; misses
+// compute the row under a mutex.
+class LazyDistanceOracle {
+public:
+  // node_vertices[i] is the graph vertex of routing node i.
+  LazyDistanceOracle(std::shared_ptr<const RoadGraph> graph,
+                     std::vector<int32_t> node_vertices, int max_cached_rows);
+
+  int64_t Distance(int from_node, int to_node);
+  int num_nodes() const { return node_vertices.size(); }
+  // Graph plus the full row cache.
+  int64_t ByteSize() const;
+  // Number of rows computed so far, evictions included.
+  int64_t rows_computed() const;
+
+private:
+  // Computes the row of from_node into a slot, under the mutex.
+  int64_t ComputeDistance(int from_node, int to_node);
+
+  const std::shared_ptr<const RoadGraph> graph;
+  const std::vector<int32_t> node_vertices;
+  const int max_cached_rows;
+  // Guards the search, the scratch row, slot allocation and the clock.
+  mutable std::mutex mutex;
+  ShortestPathSearch search;
+  std::vector<int64_t> scratch_row;
+  // Row of every slot, allocated on first use and only rewritten in place.
+  std::vector<std::unique_ptr<std::atomic<int64_t>[]>> slot_rows;
+  std::vector<std::atomic<uint32_t>> slot_versions;
+  std::vector<std::atomic<int32_t>> node_slot;
+  std::vector<std::atomic<int32_t>> slot_node;
+  std::vector<std::atomic<bool>> slot_referenced;
+  int used_slots = 0;
+  int clock_hand = 0;
+  int64_t computed = 0;
+};
+} // namespace constraint_solver
+
+#endif
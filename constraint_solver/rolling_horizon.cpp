@@ -0,0 +1,187 @@
+#include "rolling_horizon.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "constraint_solver.h"
+
+namespace constraint_solver {
+RollingHorizonPlanner::RollingHorizonPlanner(
+    std::vector<int64_t> distances, int num_nodes, int num_vehicles,
+    int depot, const RollingHorizonOptions &options)
+    : numVehicles(num_vehicles), depot(depot), options(options) {
+  if (num_nodes <= 0 || num_vehicles <= 0 || depot < 0 || depot >= num_nodes ||
+      distances.size() != static_cast<size_t>(num_nodes) * num_nodes) {
+    return;
+  }
+  matrix = FlatMatrix(num_nodes, std::move(distances));
+  committed.resize(num_vehicles);
+  open.resize(num_vehicles);
+  committedLoads.assign(num_vehicles, 0);
+  pending.assign(num_nodes, false);
+}
+
+bool RollingHorizonPlanner::SetDemands(
+    std::vector<int64_t> demands, std::vector<int64_t> vehicle_capacities) {
+  if (!IsValid() || demands.size() != static_cast<size_t>(matrix.size()) ||
+      vehicle_capacities.size() != static_cast<size_t>(numVehicles)) {
+    return false;
+  }
+  this->demands = std::move(demands);
+  capacities = std::move(vehicle_capacities);
+  for (int vehicle = 0; vehicle < numVehicles; ++vehicle) {
+    committedLoads[vehicle] = 0;
+    for (int64_t node : committed[vehicle]) {
+      committedLoads[vehicle] += this->demands[node];
+    }
+  }
+  return true;
+}
+
+bool RollingHorizonPlanner::QueueOrder(int64_t node) {
+  if (node < 0 || node >= matrix.size() || node == depot || pending[node]) {
+    return false;
+  }
+  pending[node] = true;
+  queue.push_back(node);
+  return true;
+}
+
+bool RollingHorizonPlanner::CommitVisits(int vehicle, int num_visits) {
+  if (!IsValid() || vehicle < 0 || vehicle >= numVehicles || num_visits < 0 ||
+      num_visits > static_cast<int>(open[vehicle].size())) {
+    return false;
+  }
+  std::vector<int64_t> &tail = open[vehicle];
+  for (int i = 0; i < num_visits; ++i) {
+    pending[tail[i]] = false;
+    committedLoads[vehicle] += demands.empty() ? 0 : demands[tail[i]];
+  }
+  committed[vehicle].insert(committed[vehicle].end(), tail.begin(),
+                            tail.begin() + num_visits);
+  tail.erase(tail.begin(), tail.begin() + num_visits);
+  return true;
+}
+
+int64_t RollingHorizonPlanner::Position(int vehicle) const {
+  return committed[vehicle].empty() ? depot : committed[vehicle].back();
+}
+
+bool RollingHorizonPlanner::ProcessBatch() {
+  if (!IsValid()) {
+    return false;
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  // Local node 0 is the depot, 1..numVehicles the vehicle positions, then
+  // the open visits and the batch. Positions get their own local node even
+  // when shared, so an order at a vehicle's position stays visitable.
+  std::vector<int64_t> nodes = {depot};
+  for (int vehicle = 0; vehicle < numVehicles; ++vehicle) {
+    nodes.push_back(Position(vehicle));
+  }
+  const int first_open = nodes.size();
+  for (const std::vector<int64_t> &tail : open) {
+    nodes.insert(nodes.end(), tail.begin(), tail.end());
+  }
+  const int first_order = nodes.size();
+  const int batch_size =
+      std::min<int64_t>(std::max(0, options.max_batch_orders), queue.size());
+  nodes.insert(nodes.end(), queue.begin(), queue.begin() + batch_size);
+  const int num_nodes = nodes.size();
+
+  std::vector<int64_t> distances(static_cast<size_t>(num_nodes) * num_nodes);
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = 0; to < num_nodes; ++to) {
+      distances[static_cast<size_t>(from) * num_nodes + to] =
+          matrix(nodes[from], nodes[to]);
+    }
+  }
+  RoutingWrapper wrapper;
+  wrapper.InitFlatDataModel(std::move(distances), num_nodes, numVehicles, 0);
+  std::vector<int64_t> starts(numVehicles);
+  for (int vehicle = 0; vehicle < numVehicles; ++vehicle) {
+    starts[vehicle] = 1 + vehicle;
+  }
+  wrapper.SetVehicleStartsAndEnds(starts,
+                                  std::vector<int64_t>(numVehicles, 0));
+  if (!demands.empty()) {
+    std::vector<int64_t> local_demands(num_nodes, 0);
+    for (int node = first_open; node < num_nodes; ++node) {
+      local_demands[node] = demands[nodes[node]];
+    }
+    std::vector<int64_t> remaining(numVehicles);
+    for (int vehicle = 0; vehicle < numVehicles; ++vehicle) {
+      remaining[vehicle] =
+          std::max<int64_t>(0, capacities[vehicle] - committedLoads[vehicle]);
+    }
+    wrapper.SetDemands(std::move(local_demands), std::move(remaining));
+  }
+  wrapper.CreateRoutingModelFromData();
+  wrapper.RegisterTransitCallback();
+  if (!demands.empty()) {
+    wrapper.AddCapacityDimension("Capacity");
+  }
+  // Open visits are promised; only new orders may be left for later.
+  std::vector<int64_t> penalties(num_nodes, -1);
+  std::fill(penalties.begin() + first_order, penalties.end(),
+            options.drop_penalty);
+  wrapper.SetDropPenalties(penalties);
+  std::vector<int64_t> locked_nodes;
+  std::vector<int64_t> lock_sizes(numVehicles);
+  for (int vehicle = 0, local = first_open; vehicle < numVehicles; ++vehicle) {
+    lock_sizes[vehicle] = std::min<int64_t>(std::max(0, options.locked_visits),
+                                            open[vehicle].size());
+    for (int64_t i = 0; i < lock_sizes[vehicle]; ++i) {
+      locked_nodes.push_back(local + i);
+    }
+    local += open[vehicle].size();
+  }
+  if (!locked_nodes.empty() &&
+      !wrapper.ApplyRouteLocks(locked_nodes, lock_sizes)) {
+    return false;
+  }
+  wrapper.SetFirstSolutionStrategy(options.first_solution_strategy);
+  wrapper.SetLocalSearchMetaheuristic(options.metaheuristic);
+  wrapper.CreateDefaultRoutingSearchParameters();
+  wrapper.SetTimeLimit(options.time_limit_ms);
+  const bool solved = wrapper.SolveWithCurrentParameters();
+  lastModelSize = num_nodes;
+  lastBatchMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start_time)
+                    .count();
+  if (!solved) {
+    return false;
+  }
+
+  for (int vehicle = 0; vehicle < numVehicles; ++vehicle) {
+    const std::vector<int64_t> route = wrapper.GetRoute(vehicle);
+    open[vehicle].clear();
+    for (size_t i = 1; i + 1 < route.size(); ++i) {
+      open[vehicle].push_back(nodes[route[i]]);
+    }
+  }
+  queue.erase(queue.begin(), queue.begin() + batch_size);
+  // Left out orders wait for the next batch, behind the ones already queued.
+  for (int64_t node : wrapper.GetDroppedNodes()) {
+    queue.push_back(nodes[node]);
+  }
+  return true;
+}
+
+std::vector<int64_t> RollingHorizonPlanner::GetCommittedVisits(
+    int vehicle) const {
+  if (vehicle < 0 || vehicle >= numVehicles || !IsValid()) {
+    return {};
+  }
+  return committed[vehicle];
+}
+
+std::vector<int64_t> RollingHorizonPlanner::GetOpenVisits(int vehicle) const {
+  if (vehicle < 0 || vehicle >= numVehicles || !IsValid()) {
+    return {};
+  }
+  return open[vehicle];
+}
+} // namespace constraint_solver
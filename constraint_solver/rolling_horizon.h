@@ -0,0 +1,84 @@
+#ifndef ROLLING_HORIZON_H
+#define ROLLING_HORIZON_H
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+struct RollingHorizonOptions {
+  // Most queued orders inserted by one ProcessBatch.
+  int max_batch_orders = 50;
+  // Open visits at the head of every route that stay in place, e.g. because
+  // the driver already got them.
+  int locked_visits = 1;
+  // Search time limit of one ProcessBatch.
+  int64_t time_limit_ms = 1000;
+  std::string first_solution_strategy = "PARALLEL_CHEAPEST_INSERTION";
+  std::string metaheuristic = "GUIDED_LOCAL_SEARCH";
+  // Cost of leaving a batch order out; left out orders go back to the queue.
+  int64_t drop_penalty = 1000000;
+};
+
+// Plans a day of continuously arriving orders. Every route is a committed
+// prefix, which is final, followed by an open tail. Each ProcessBatch solves
+// a model holding only the open tails and a micro-batch of queued orders,
+// with every vehicle starting at its last committed node, so its cost
+// depends on the open work rather than on how many visits the day already
+// had. The first locked_visits open visits of every route are frozen with
+// route locks.
+class RollingHorizonPlanner {
+public:
+  // distances is the row-major num_nodes x num_nodes matrix over every node
+  // orders may use. Vehicles start and end at depot.
+  RollingHorizonPlanner(std::vector<int64_t> distances, int num_nodes,
+                        int num_vehicles, int depot,
+                        const RollingHorizonOptions &options);
+  bool IsValid() const { return matrix.size() > 0; }
+  // demands is indexed by node and vehicle_capacities by vehicle. Returns
+  // false on mismatched sizes.
+  bool SetDemands(std::vector<int64_t> demands,
+                  std::vector<int64_t> vehicle_capacities);
+  // Queues an order at node. Returns false for the depot, unknown nodes and
+  // nodes already queued or open.
+  bool QueueOrder(int64_t node);
+  // Makes the first num_visits open visits of vehicle final: they leave the
+  // model and the vehicle continues from the last of them. Returns false if
+  // the tail is shorter.
+  bool CommitVisits(int vehicle, int num_visits);
+  // Inserts up to max_batch_orders queued orders, oldest first, and
+  // reoptimizes the open tails. Returns false, leaving the plan and the
+  // queue untouched, if the model has no solution.
+  bool ProcessBatch();
+  // Visits of vehicle, depot excluded.
+  std::vector<int64_t> GetCommittedVisits(int vehicle) const;
+  std::vector<int64_t> GetOpenVisits(int vehicle) const;
+  int64_t GetQueuedOrders() const { return queue.size(); }
+  // Nodes in the model of the last ProcessBatch and its wall time.
+  int64_t GetLastModelSize() const { return lastModelSize; }
+  int64_t GetLastBatchMs() const { return lastBatchMs; }
+
+private:
+  int64_t Position(int vehicle) const;
+
+  FlatMatrix matrix;
+  int numVehicles;
+  int depot;
+  RollingHorizonOptions options;
+  std::vector<int64_t> demands;
+  std::vector<int64_t> capacities;
+  std::vector<std::vector<int64_t>> committed;
+  std::vector<std::vector<int64_t>> open;
+  // Load of the committed visits of every vehicle.
+  std::vector<int64_t> committedLoads;
+  std::deque<int64_t> queue;
+  // Whether a node is queued or open.
+  std::vector<bool> pending;
+  int64_t lastModelSize = 0;
+  int64_t lastBatchMs = 0;
+};
+} // namespace constraint_solver
+
+#endif
@@ -0,0 +1,181 @@
+#include "route_improvement.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+// Nodes are addressed by their position in the original route ("local ids"),
+// so every lookup is an array access.
+class RouteImprover {
+public:
+  RouteImprover(const FlatMatrix &matrix, int num_neighbors,
+                const std::vector<int64_t> &nodes)
+      : matrix(matrix), nodes(nodes), size(nodes.size()), order(size),
+        position(size), forward(size), backward(size), neighbors(size) {
+    std::iota(order.begin(), order.end(), 0);
+    for (int node = 0; node < size; ++node) {
+      std::vector<int> &candidates = neighbors[node];
+      for (int other = 0; other < size; ++other) {
+        if (other != node) {
+          candidates.push_back(other);
+        }
+      }
+      const int kept = std::min<int>(num_neighbors, candidates.size());
+      std::partial_sort(candidates.begin(), candidates.begin() + kept,
+                        candidates.end(), [this, node](int a, int b) {
+                          return Cost(node, a) < Cost(node, b);
+                        });
+      candidates.resize(kept);
+    }
+    Update();
+  }
+
+  bool Run() {
+    bool improved = false;
+    while (TwoOpt() || OrOpt()) {
+      improved = true;
+    }
+    return improved;
+  }
+
+  void Write(std::vector<int64_t> *route) const {
+    for (int i = 0; i < size; ++i) {
+      (*route)[i] = nodes[order[i]];
+    }
+  }
+
+private:
+  int64_t Cost(int from, int to) const {
+    return matrix(nodes[from], nodes[to]);
+  }
+
+  void Update() {
+    for (int i = 0; i < size; ++i) {
+      position[order[i]] = i;
+    }
+    forward[0] = 0;
+    backward[0] = 0;
+    for (int i = 1; i < size; ++i) {
+      forward[i] = forward[i - 1] + Cost(order[i - 1], order[i]);
+      backward[i] = backward[i - 1] + Cost(order[i], order[i - 1]);
+    }
+  }
+
+  // Reverses order[i + 1..j] when order[j] is a neighbor of order[i].
+  bool TwoOpt() {
+    for (int i = 0; i + 3 < size; ++i) {
+      const int a = order[i];
+      const int b = order[i + 1];
+      for (int c : neighbors[a]) {
+        const int j = position[c];
+        if (j <= i + 1 || j > size - 2) {
+          continue;
+        }
+        const int d = order[j + 1];
+        const int64_t delta = Cost(a, c) + Cost(b, d) - Cost(a, b) -
+                              Cost(c, d) + (backward[j] - backward[i + 1]) -
+                              (forward[j] - forward[i + 1]);
+        if (delta < 0) {
+          std::reverse(order.begin() + i + 1, order.begin() + j + 1);
+          Update();
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Moves order[s..e] between order[q] and order[q + 1], next to a neighbor
+  // of its first node.
+  bool OrOpt() {
+    for (int length = 1; length <= 3; ++length) {
+      for (int s = 1; s + length < size; ++s) {
+        const int e = s + length - 1;
+        const int first = order[s];
+        const int last = order[e];
+        const int64_t removal_gain = Cost(order[s - 1], first) +
+                                     Cost(last, order[e + 1]) -
+                                     Cost(order[s - 1], order[e + 1]);
+        for (int neighbor : neighbors[first]) {
+          for (int q : {position[neighbor], position[neighbor] - 1}) {
+            if (q < 0 || q > size - 2 || (q >= s - 1 && q <= e)) {
+              continue;
+            }
+            const int64_t insertion_cost = Cost(order[q], first) +
+                                           Cost(last, order[q + 1]) -
+                                           Cost(order[q], order[q + 1]);
+            if (insertion_cost < removal_gain) {
+              if (q > e) {
+                std::rotate(order.begin() + s, order.begin() + e + 1,
+                            order.begin() + q + 1);
+              } else {
+                std::rotate(order.begin() + q + 1, order.begin() + s,
+                            order.begin() + e + 1);
+              }
+              Update();
+              return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  const FlatMatrix &matrix;
+  const std::vector<int64_t> nodes;
+  const int size;
+  std::vector<int> order;
+  std::vector<int> position;
+  // Prefix sums of arc costs along order, traversed forwards and backwards,
+  // so reversing a segment of an asymmetric route is priced in O(1).
+  std::vector<int64_t> forward;
+  std::vector<int64_t> backward;
+  std::vector<std::vector<int>> neighbors;
+};
+} // namespace
+
+bool ImproveRoute(const FlatMatrix &matrix, int num_neighbors,
+                  std::vector<int64_t> *route) {
+  if (route->size() < 4 || num_neighbors < 1) {
+    return false;
+  }
+  RouteImprover improver(matrix, num_neighbors, *route);
+  if (!improver.Run()) {
+    return false;
+  }
+  improver.Write(route);
+  return true;
+}
+
+bool ImproveRoutes(const FlatMatrix &matrix, int num_neighbors,
+                   int num_threads, std::vector<std::vector<int64_t>> *routes) {
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  num_threads = std::min<int>(num_threads, routes->size());
+  std::atomic<size_t> next_route(0);
+  std::atomic<bool> improved(false);
+  auto worker = [&]() {
+    for (size_t route = next_route++; route < routes->size();
+         route = next_route++) {
+      if (ImproveRoute(matrix, num_neighbors, &(*routes)[route])) {
+        improved = true;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  return improved;
+}
+} // namespace constraint_solver
@@ -0,0 +1,24 @@
+#ifndef ROUTE_IMPROVEMENT_H
+#define ROUTE_IMPROVEMENT_H
+#include <cstdint>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+// Improves the order of one route with first-improvement 2-opt and Or-opt
+// (segments of up to three nodes) moves. Candidate moves are limited to the
+// num_neighbors closest nodes of the same route. route holds node ids; its
+// first and last nodes stay in place. Works on asymmetric matrices. Returns
+// true if the route changed; num_neighbors < 1 changes nothing.
+bool ImproveRoute(const FlatMatrix &matrix, int num_neighbors,
+                  std::vector<int64_t> *route);
+
+// Runs ImproveRoute on every route, spreading routes over up to num_threads
+// threads (hardware concurrency when num_threads <= 0). Returns true if any
+// route changed.
+bool ImproveRoutes(const FlatMatrix &matrix, int num_neighbors,
+                   int num_threads, std::vector<std::vector<int64_t>> *routes);
+} // namespace constraint_solver
+
+#endif
@@ -0,0 +1,341 @@
+#include "ruin_recreate.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+// Attempts each chain runs before the best chain is shared.
+constexpr int kIterationsPerRound = 100;
+// Longest string removed from one route by a string ruin.
+constexpr int kMaxStringLength = 10;
+constexpr int64_t kNoInsertion = std::numeric_limits<int64_t>::max();
+
+// Read-only data shared by all threads.
+struct Instance {
+  const FlatMatrix &matrix;
+  const std::vector<int64_t> &demands;
+  const std::vector<int64_t> &capacities;
+  std::vector<int> starts;
+  std::vector<int> ends;
+  // Routed customers, and the closest ones to every node.
+  std::vector<int> customers;
+  std::vector<std::vector<int>> neighbors;
+
+  int64_t Demand(int node) const {
+    return demands.empty() ? 0 : demands[node];
+  }
+  int64_t Capacity(int route) const {
+    return capacities.empty() ? std::numeric_limits<int64_t>::max()
+                              : capacities[route];
+  }
+};
+
+struct Solution {
+  // Customers of every route, without start and end.
+  std::vector<std::vector<int>> routes;
+  std::vector<int64_t> loads;
+  int64_t cost = 0;
+};
+
+int64_t RouteCost(const Instance &instance, int route,
+                  const std::vector<int> &customers) {
+  int previous = instance.starts[route];
+  int64_t cost = 0;
+  for (int customer : customers) {
+    cost += instance.matrix(previous, customer);
+    previous = customer;
+  }
+  return cost + instance.matrix(previous, instance.ends[route]);
+}
+
+class RuinRecreateChain {
+public:
+  RuinRecreateChain(const Instance &instance, int max_ruined)
+      : instance(instance), max_ruined(max_ruined),
+        route_of(instance.matrix.size(), -1),
+        removed(instance.matrix.size(), false) {}
+
+  // Runs iterations attempts from start and returns the best solution.
+  Solution Run(const Solution &start, int iterations, std::mt19937 *random) {
+    Solution best = start;
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+      Solution candidate = best;
+      Ruin(&candidate, random);
+      if (Recreate(&candidate) && candidate.cost < best.cost) {
+        best = std::move(candidate);
+      }
+    }
+    return best;
+  }
+
+private:
+  void Ruin(Solution *solution, std::mt19937 *random) {
+    for (size_t route = 0; route < solution->routes.size(); ++route) {
+      for (int customer : solution->routes[route]) {
+        route_of[customer] = route;
+      }
+    }
+    const std::vector<int> &customers = instance.customers;
+    const int seed = customers[(*random)() % customers.size()];
+    const int target = 1 + (*random)() % std::min<int>(max_ruined,
+                                                        customers.size());
+    ruined.clear();
+    auto remove = [this](int customer) {
+      if (!removed[customer]) {
+        removed[customer] = true;
+        ruined.push_back(customer);
+      }
+    };
+    remove(seed);
+    const bool strings = (*random)() % 2 == 0;
+    std::vector<bool> route_ruined(solution->routes.size(), false);
+    for (int neighbor : instance.neighbors[seed]) {
+      if (static_cast<int>(ruined.size()) >= target) {
+        break;
+      }
+      if (!strings) {
+        remove(neighbor);
+        continue;
+      }
+      // One string per route, through the neighbor.
+      const int route = route_of[neighbor];
+      if (route < 0 || route_ruined[route]) {
+        continue;
+      }
+      route_ruined[route] = true;
+      const std::vector<int> &customers_of_route = solution->routes[route];
+      const int size = customers_of_route.size();
+      const int position =
+          std::find(customers_of_route.begin(), customers_of_route.end(),
+                    neighbor) -
+          customers_of_route.begin();
+      const int length = 1 + (*random)() % std::min(kMaxStringLength, size);
+      const int first = std::max(
+          0, std::min(position - static_cast<int>((*random)() % length),
+                      size - length));
+      for (int i = first; i < first + length &&
+                          static_cast<int>(ruined.size()) < target;
+           ++i) {
+        remove(customers_of_route[i]);
+      }
+    }
+
+    for (size_t route = 0; route < solution->routes.size(); ++route) {
+      std::vector<int> &customers_of_route = solution->routes[route];
+      for (int customer : customers_of_route) {
+        if (removed[customer]) {
+          solution->loads[route] -= instance.Demand(customer);
+        }
+      }
+      customers_of_route.erase(
+          std::remove_if(customers_of_route.begin(), customers_of_route.end(),
+                         [this](int customer) { return removed[customer]; }),
+          customers_of_route.end());
+    }
+    for (int customer : ruined) {
+      removed[customer] = false;
+      route_of[customer] = -1;
+    }
+  }
+
+  // Cheapest insertion of customer into route, or kNoInsertion if it does not
+  // fit.
+  void EvaluateInsertion(const Solution &solution, int customer, int route,
+                         int64_t *cost, int *position) const {
+    *cost = kNoInsertion;
+    if (solution.loads[route] + instance.Demand(customer) >
+        instance.Capacity(route)) {
+      return;
+    }
+    const std::vector<int> &customers = solution.routes[route];
+    int previous = instance.starts[route];
+    for (size_t i = 0; i <= customers.size(); ++i) {
+      const int next =
+          i < customers.size() ? customers[i] : instance.ends[route];
+      const int64_t delta = instance.matrix(previous, customer) +
+                            instance.matrix(customer, next) -
+                            instance.matrix(previous, next);
+      if (delta < *cost) {
+        *cost = delta;
+        *position = i;
+      }
+      previous = next;
+    }
+  }
+
+  // Regret-2 insertion: the customer losing most by missing its best route
+  // goes first. Insertion costs are cached per (customer, route) and only the
+  // route that changed is reevaluated.
+  bool Recreate(Solution *solution) {
+    const int num_routes = solution->routes.size();
+    const int num_ruined = ruined.size();
+    costs.assign(static_cast<size_t>(num_ruined) * num_routes, kNoInsertion);
+    positions.assign(costs.size(), 0);
+    for (int c = 0; c < num_ruined; ++c) {
+      for (int route = 0; route < num_routes; ++route) {
+        EvaluateInsertion(*solution, ruined[c], route,
+                          &costs[c * num_routes + route],
+                          &positions[c * num_routes + route]);
+      }
+    }
+    std::vector<bool> inserted(num_ruined, false);
+    for (int step = 0; step < num_ruined; ++step) {
+      int chosen = -1;
+      int chosen_route = -1;
+      int64_t chosen_regret = -1;
+      int64_t chosen_cost = kNoInsertion;
+      for (int c = 0; c < num_ruined; ++c) {
+        if (inserted[c]) {
+          continue;
+        }
+        int64_t best = kNoInsertion;
+        int64_t second = kNoInsertion;
+        int best_route = -1;
+        for (int route = 0; route < num_routes; ++route) {
+          const int64_t cost = costs[c * num_routes + route];
+          if (cost < best) {
+            second = best;
+            best = cost;
+            best_route = route;
+          } else if (cost < second) {
+            second = cost;
+          }
+        }
+        if (best_route < 0) {
+          return false;
+        }
+        const int64_t regret =
+            second == kNoInsertion ? kNoInsertion : second - best;
+        if (regret > chosen_regret ||
+            (regret == chosen_regret && best < chosen_cost)) {
+          chosen = c;
+          chosen_route = best_route;
+          chosen_regret = regret;
+          chosen_cost = best;
+        }
+      }
+      inserted[chosen] = true;
+      std::vector<int> &route = solution->routes[chosen_route];
+      route.insert(route.begin() + positions[chosen * num_routes + chosen_route],
+                   ruined[chosen]);
+      solution->loads[chosen_route] += instance.Demand(ruined[chosen]);
+      for (int c = 0; c < num_ruined; ++c) {
+        if (!inserted[c]) {
+          EvaluateInsertion(*solution, ruined[c], chosen_route,
+                            &costs[c * num_routes + chosen_route],
+                            &positions[c * num_routes + chosen_route]);
+        }
+      }
+    }
+    solution->cost = 0;
+    for (int route = 0; route < num_routes; ++route) {
+      solution->cost += RouteCost(instance, route, solution->routes[route]);
+    }
+    return true;
+  }
+
+  const Instance &instance;
+  const int max_ruined;
+  std::vector<int> route_of;
+  std::vector<bool> removed;
+  std::vector<int> ruined;
+  std::vector<int64_t> costs;
+  std::vector<int> positions;
+};
+} // namespace
+
+bool RuinAndRecreate(const FlatMatrix &matrix,
+                     const std::vector<int64_t> &demands,
+                     const std::vector<int64_t> &capacities,
+                     const RuinRecreateOptions &options,
+                     std::vector<std::vector<int64_t>> *routes) {
+  Instance instance{matrix, demands, capacities, {}, {}, {}, {}};
+  Solution start;
+  for (size_t route = 0; route < routes->size(); ++route) {
+    const std::vector<int64_t> &nodes = (*routes)[route];
+    instance.starts.push_back(nodes.front());
+    instance.ends.push_back(nodes.back());
+    start.routes.emplace_back(nodes.begin() + 1, nodes.end() - 1);
+    start.loads.push_back(0);
+    for (int customer : start.routes.back()) {
+      instance.customers.push_back(customer);
+      start.loads.back() += instance.Demand(customer);
+    }
+    start.cost += RouteCost(instance, route, start.routes.back());
+  }
+  if (instance.customers.empty() || options.iterations <= 0) {
+    return false;
+  }
+  instance.neighbors.resize(matrix.size());
+  std::vector<int> candidates;
+  for (int customer : instance.customers) {
+    candidates = instance.customers;
+    candidates.erase(
+        std::find(candidates.begin(), candidates.end(), customer));
+    const int kept = std::min<int>(options.num_neighbors, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + kept,
+                      candidates.end(), [&matrix, customer](int a, int b) {
+                        return matrix(customer, a) < matrix(customer, b);
+                      });
+    candidates.resize(kept);
+    instance.neighbors[customer] = candidates;
+  }
+
+  int num_threads = options.num_threads;
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  const int64_t initial_cost = start.cost;
+  Solution best = std::move(start);
+  std::vector<Solution> results(num_threads);
+  for (int64_t done = 0, round = 0; done < options.iterations; ++round) {
+    const int iterations = std::max<int64_t>(
+        1, std::min<int64_t>(kIterationsPerRound,
+                             (options.iterations - done) / num_threads));
+    auto run = [&](int thread) {
+      std::seed_seq seed{options.seed, static_cast<uint32_t>(round),
+                         static_cast<uint32_t>(thread)};
+      std::mt19937 random(seed);
+      RuinRecreateChain chain(instance, std::max(1, options.max_ruined));
+      results[thread] = chain.Run(best, iterations, &random);
+    };
+    std::vector<std::thread> threads;
+    for (int thread = 1; thread < num_threads; ++thread) {
+      threads.emplace_back(run, thread);
+    }
+    run(0);
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    // Ties go to the lowest thread, keeping runs reproducible.
+    for (Solution &result : results) {
+      if (result.cost < best.cost) {
+        best = std::move(result);
+      }
+    }
+    done += iterations * num_threads;
+    if (options.time_limit_ms > 0 &&
+        std::chrono::steady_clock::now() - start_time >=
+            std::chrono::milliseconds(options.time_limit_ms)) {
+      break;
+    }
+  }
+  if (best.cost >= initial_cost) {
+    return false;
+  }
+  for (size_t route = 0; route < routes->size(); ++route) {
+    std::vector<int64_t> &nodes = (*routes)[route];
+    nodes.resize(1);
+    nodes.insert(nodes.end(), best.routes[route].begin(),
+                 best.routes[route].end());
+    nodes.push_back(instance.ends[route]);
+  }
+  return true;
+}
+} // namespace constraint_solver
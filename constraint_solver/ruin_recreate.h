@@ -0,0 +1,39 @@
+#ifndef RUIN_RECREATE_H
+#define RUIN_RECREATE_H
+#include <cstdint>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+struct RuinRecreateOptions {
+  // Total ruin and recreate attempts over all threads.
+  int iterations = 1000;
+  // Stops after the first round past this wall time; 0 means no limit.
+  // Runs cut by the limit are not reproducible.
+  int64_t time_limit_ms = 0;
+  // Hardware concurrency when <= 0.
+  int num_threads = 0;
+  uint32_t seed = 0;
+  // Most customers removed by one ruin.
+  int max_ruined = 30;
+  // Closest customers considered around the ruin seed.
+  int num_neighbors = 50;
+};
+
+// Large neighborhood search over routes given as node ids with their start
+// and end. Each attempt removes customers close to a random seed, either the
+// seed's nearest neighbors or strings of the routes they lie on, and
+// reinserts them by regret-2 insertion. Threads run independent chains from
+// the best routes found so far and keep improving attempts only; the best
+// chain is shared every round, so a run is reproducible for a given seed and
+// thread count. demands is indexed by node and capacities by route; leave
+// them empty to ignore capacities. Returns true if routes got shorter.
+bool RuinAndRecreate(const FlatMatrix &matrix,
+                     const std::vector<int64_t> &demands,
+                     const std::vector<int64_t> &capacities,
+                     const RuinRecreateOptions &options,
+                     std::vector<std::vector<int64_t>> *routes);
+} // namespace constraint_solver
+
+#endif
@@ -0,0 +1,165 @@
+#include "solution_export.h"
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+constexpr uint64_t kBinaryVersion = 1;
+} // namespace
+
+void ExportSink::AppendVarint(uint64_t value) {
+  char bytes[10];
+  int length = 0;
+  while (value >= 0x80) {
+    bytes[length++] = static_cast<char>(value | 0x80);
+    value >>= 7;
+  }
+  bytes[length++] = static_cast<char>(value);
+  Append(bytes, length);
+}
+
+void ExportSink::AppendDecimal(int64_t value) {
+  char text[24];
+  const std::to_chars_result result =
+      std::to_chars(text, text + sizeof(text), value);
+  Append(text, result.ptr - text);
+}
+
+void ExportSink::AppendDecimal(double value) {
+  char text[32];
+  const std::to_chars_result result =
+      std::to_chars(text, text + sizeof(text), value);
+  Append(text, result.ptr - text);
+}
+
+void ExportSink::Overflow(const char *data, size_t length) {
+  if (fd < 0) {
+    const int64_t fits = capacity - used;
+    std::memcpy(buffer + used, data, fits);
+    used = capacity;
+    dropped += length - fits;
+    return;
+  }
+  Flush();
+  // Large pieces bypass the chunk.
+  if (static_cast<int64_t>(length) >= capacity) {
+    while (length > 0 && !failed) {
+      const ssize_t written = ::write(fd, data, length);
+      if (written < 0 && errno == EINTR) {
+        continue;
+      }
+      if (written <= 0) {
+        failed = true;
+        return;
+      }
+      data += written;
+      length -= written;
+      flushed += written;
+    }
+    return;
+  }
+  std::memcpy(buffer, data, length);
+  used = length;
+}
+
+bool ExportSink::Flush() {
+  int64_t offset = 0;
+  while (offset < used && !failed) {
+    const ssize_t written = ::write(fd, buffer + offset, used - offset);
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      failed = true;
+      break;
+    }
+    offset += written;
+  }
+  flushed += offset;
+  used = 0;
+  return !failed;
+}
+
+bool ExportSink::Finish() {
+  if (fd < 0) {
+    return true;
+  }
+  return Flush();
+}
+
+void BinaryRouteExporter::Begin(int64_t objective, int num_routes,
+                                bool with_cumuls) {
+  sink->AppendVarint(kBinaryVersion);
+  sink->AppendZigZag(objective);
+  sink->AppendVarint(with_cumuls ? 1 : 0);
+  sink->AppendVarint(num_routes);
+}
+
+void BinaryRouteExporter::Route(int /*vehicle*/,
+                                const std::vector<int64_t> &nodes,
+                                const std::vector<int64_t> &cumuls) {
+  sink->AppendVarint(nodes.size());
+  int64_t previous_cumul = 0;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    sink->AppendVarint(nodes[i]);
+    if (!cumuls.empty()) {
+      sink->AppendZigZag(cumuls[i] - previous_cumul);
+      previous_cumul = cumuls[i];
+    }
+  }
+}
+
+void GeoJsonRouteExporter::Begin(int64_t objective, int /*num_routes*/,
+                                 bool /*with_cumuls*/) {
+  Literal("{\"type\":\"FeatureCollection\",\"properties\":{\"objective\":");
+  sink->AppendDecimal(objective);
+  Literal("},\"features\":[");
+}
+
+void GeoJsonRouteExporter::Route(int vehicle,
+                                 const std::vector<int64_t> &nodes,
+                                 const std::vector<int64_t> &cumuls) {
+  // Vehicles going straight from start to end are left out.
+  if (nodes.size() <= 2) {
+    return;
+  }
+  Literal(first_feature ? "{" : ",{");
+  first_feature = false;
+  Literal("\"type\":\"Feature\",\"geometry\":{\"type\":\"LineString\","
+          "\"coordinates\":[");
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    Literal(i == 0 ? "[" : ",[");
+    sink->AppendDecimal(longitudes[nodes[i]]);
+    sink->Append(',');
+    sink->AppendDecimal(latitudes[nodes[i]]);
+    sink->Append(']');
+  }
+  Literal("]},\"properties\":{\"vehicle\":");
+  sink->AppendDecimal(static_cast<int64_t>(vehicle));
+  Literal(",\"nodes\":[");
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (i > 0) {
+      sink->Append(',');
+    }
+    sink->AppendDecimal(nodes[i]);
+  }
+  sink->Append(']');
+  if (!cumuls.empty()) {
+    Literal(",\"cumuls\":[");
+    for (size_t i = 0; i < cumuls.size(); ++i) {
+      if (i > 0) {
+        sink->Append(',');
+      }
+      sink->AppendDecimal(cumuls[i]);
+    }
+    sink->Append(']');
+  }
+  Literal("}}");
+}
+
+void GeoJsonRouteExporter::End() { Literal("]}"); }
+} // namespace constraint_solver
@@ -0,0 +1,113 @@
+#ifndef SOLUTION_EXPORT_H
+#define SOLUTION_EXPORT_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace constraint_solver {
+// Destination of an export: either a caller buffer, filled in place, or a
+// file descriptor, written through a fixed chunk. In buffer mode the bytes
+// beyond capacity are dropped but still counted, so size() tells the caller
+// how large a buffer the full export needs.
+class ExportSink {
+public:
+  ExportSink(char *buffer, int64_t capacity)
+      : buffer(buffer), capacity(capacity > 0 ? capacity : 0) {}
+  explicit ExportSink(int fd)
+      : buffer(chunk), capacity(sizeof(chunk)), fd(fd) {}
+  ExportSink(const ExportSink &) = delete;
+  ExportSink &operator=(const ExportSink &) = delete;
+
+  void Append(const char *data, size_t length) {
+    if (used + static_cast<int64_t>(length) > capacity) {
+      Overflow(data, length);
+      return;
+    }
+    std::memcpy(buffer + used, data, length);
+    used += length;
+  }
+  void Append(char c) { Append(&c, 1); }
+  void AppendVarint(uint64_t value);
+  void AppendZigZag(int64_t value) {
+    AppendVarint((static_cast<uint64_t>(value) << 1) ^
+                 static_cast<uint64_t>(value >> 63));
+  }
+  void AppendDecimal(int64_t value);
+  // Shortest representation that reads back to the same double.
+  void AppendDecimal(double value);
+
+  // Writes what is left in the chunk to the descriptor. Returns false if a
+  // write failed.
+  bool Finish();
+  // Bytes produced so far, dropped ones included.
+  int64_t size() const { return flushed + used + dropped; }
+
+private:
+  void Overflow(const char *data, size_t length);
+  bool Flush();
+
+  char *buffer;
+  int64_t capacity;
+  int64_t used = 0;
+  int64_t flushed = 0;
+  int64_t dropped = 0;
+  int fd = -1;
+  bool failed = false;
+  char chunk[1 << 16];
+};
+
+// Receives the solution one route at a time. nodes and cumuls are reused
+// between routes by the caller; cumuls is empty when no dimension is
+// exported.
+class RouteExporter {
+public:
+  virtual ~RouteExporter() = default;
+  virtual void Begin(int64_t objective, int num_routes, bool with_cumuls) = 0;
+  virtual void Route(int vehicle, const std::vector<int64_t> &nodes,
+                     const std::vector<int64_t> &cumuls) = 0;
+  virtual void End() = 0;
+};
+
+// Compact binary export. All integers are LEB128 varints, signed ones
+// zigzag-encoded:
+//   version (1), objective (signed), with_cumuls (0 or 1), num_routes,
+// then per route its number of nodes and per node its id followed, with
+// cumuls, by its cumul minus the previous cumul of the route (signed).
+class BinaryRouteExporter : public RouteExporter {
+public:
+  explicit BinaryRouteExporter(ExportSink *sink) : sink(sink) {}
+
+  void Begin(int64_t objective, int num_routes, bool with_cumuls) override;
+  void Route(int vehicle, const std::vector<int64_t> &nodes,
+             const std::vector<int64_t> &cumuls) override;
+  void End() override {}
+
+private:
+  ExportSink *sink;
+};
+
+// GeoJSON FeatureCollection with one LineString feature per used vehicle,
+// whose properties hold the vehicle, the node ids and the cumuls.
+class GeoJsonRouteExporter : public RouteExporter {
+public:
+  GeoJsonRouteExporter(ExportSink *sink, const std::vector<double> &longitudes,
+                       const std::vector<double> &latitudes)
+      : sink(sink), longitudes(longitudes), latitudes(latitudes) {}
+
+  void Begin(int64_t objective, int num_routes, bool with_cumuls) override;
+  void Route(int vehicle, const std::vector<int64_t> &nodes,
+             const std::vector<int64_t> &cumuls) override;
+  void End() override;
+
+private:
+  void Literal(const char *text) { sink->Append(text, std::strlen(text)); }
+
+  ExportSink *sink;
+  const std::vector<double> &longitudes;
+  const std::vector<double> &latitudes;
+  bool first_feature = true;
+};
+} // namespace constraint_solver
+
+#endif
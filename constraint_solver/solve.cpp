@@ -0,0 +1,174 @@
+#include "solve.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constraint_solver.h"
+
+namespace constraint_solver {
+namespace {
+constexpr int64_t kBufferVersion = 1;
+
+class BufferReader {
+public:
+  BufferReader(const char *buffer, int64_t size)
+      : next(buffer), remaining(size > 0 ? size : 0) {}
+
+  bool ok() const { return valid; }
+
+  int64_t Int() {
+    int64_t value = 0;
+    if (remaining < sizeof(value)) {
+      valid = false;
+      return 0;
+    }
+    std::memcpy(&value, next, sizeof(value));
+    next += sizeof(value);
+    remaining -= sizeof(value);
+    return value;
+  }
+
+  std::vector<int64_t> Ints(int64_t count) {
+    if (count < 0 ||
+        static_cast<uint64_t>(count) > remaining / sizeof(int64_t)) {
+      valid = false;
+      return {};
+    }
+    std::vector<int64_t> values(count);
+    std::memcpy(values.data(), next, count * sizeof(int64_t));
+    next += count * sizeof(int64_t);
+    remaining -= count * sizeof(int64_t);
+    return values;
+  }
+
+  std::string Bytes(int64_t count) {
+    if (count < 0 || static_cast<uint64_t>(count) > remaining) {
+      valid = false;
+      return {};
+    }
+    std::string bytes(next, count);
+    next += count;
+    remaining -= count;
+    return bytes;
+  }
+
+private:
+  const char *next;
+  size_t remaining;
+  bool valid = true;
+};
+
+void AppendInt(int64_t value, std::string *buffer) {
+  buffer->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+std::string EncodeResult(const SolveResult &result) {
+  size_t words = 3;
+  for (const std::vector<int64_t> &route : result.routes) {
+    words += 1 + route.size();
+  }
+  std::string buffer;
+  buffer.reserve(words * sizeof(int64_t));
+  AppendInt(result.status, &buffer);
+  AppendInt(result.objective, &buffer);
+  AppendInt(result.routes.size(), &buffer);
+  for (const std::vector<int64_t> &route : result.routes) {
+    AppendInt(route.size(), &buffer);
+    buffer.append(reinterpret_cast<const char *>(route.data()),
+                  route.size() * sizeof(int64_t));
+  }
+  return buffer;
+}
+
+// Takes the problem by value so that SolveBuffer can move the decoded matrix
+// into the model.
+SolveResult SolveProblem(ProblemSpec problem, const SolveOptions &options) {
+  SolveResult result;
+  RoutingWrapper wrapper;
+  if (!wrapper.InitFlatDataModel(std::move(problem.distance_matrix),
+                                 problem.num_nodes, problem.num_vehicles,
+                                 problem.depot) ||
+      (!problem.starts.empty() &&
+       !wrapper.SetVehicleStartsAndEnds(problem.starts, problem.ends))) {
+    result.status = SolveResult::kInvalid;
+    return result;
+  }
+  wrapper.CreateRoutingModelFromData();
+  const int transit_callback_index = wrapper.RegisterTransitCallback();
+  if (problem.max_route_distance > 0) {
+    wrapper.AddDimensionWithVehicleCapacity(
+        transit_callback_index, 0,
+        std::vector<int64_t>(problem.num_vehicles,
+                             problem.max_route_distance),
+        true, "Distance");
+  }
+
+  wrapper.CreateDefaultRoutingSearchParameters();
+  wrapper.SetFirstSolutionStrategy(options.first_solution_strategy);
+  if (options.time_limit_ms > 0) {
+    wrapper.SetTimeLimit(options.time_limit_ms);
+  }
+  if (options.deterministic &&
+      !wrapper.SetDeterministicMode(options.seed, options.solution_limit)) {
+    result.status = SolveResult::kInvalid;
+    return result;
+  }
+  wrapper.SolveWithCurrentParameters();
+  if (!wrapper.HasSolution()) {
+    return result;
+  }
+  if (options.improve_neighbors > 0) {
+    wrapper.ImproveRoutesAfterSolve(options.improve_neighbors,
+                                    options.improve_threads);
+  }
+
+  result.status = SolveResult::kSolved;
+  result.objective = wrapper.GetObjectiveValue();
+  result.routes.reserve(problem.num_vehicles);
+  for (int vehicle = 0; vehicle < problem.num_vehicles; ++vehicle) {
+    result.routes.push_back(wrapper.GetRoute(vehicle));
+  }
+  return result;
+}
+} // namespace
+
+SolveResult Solve(const ProblemSpec &problem, const SolveOptions &options) {
+  return SolveProblem(problem, options);
+}
+
+std::string SolveBuffer(const char *request, int64_t size) {
+  BufferReader reader(request, size);
+  ProblemSpec problem;
+  SolveOptions options;
+  SolveResult invalid;
+  invalid.status = SolveResult::kInvalid;
+  if (reader.Int() != kBufferVersion) {
+    return EncodeResult(invalid);
+  }
+  problem.num_nodes = reader.Int();
+  problem.num_vehicles = reader.Int();
+  problem.depot = reader.Int();
+  problem.max_route_distance = reader.Int();
+  const int64_t num_starts = reader.Int();
+  problem.starts = reader.Ints(num_starts);
+  problem.ends = reader.Ints(num_starts);
+  if (!reader.ok() || problem.num_nodes <= 0) {
+    return EncodeResult(invalid);
+  }
+  problem.distance_matrix =
+      reader.Ints(static_cast<int64_t>(problem.num_nodes) * problem.num_nodes);
+  options.time_limit_ms = reader.Int();
+  options.deterministic = reader.Int() != 0;
+  options.seed = reader.Int();
+  options.solution_limit = reader.Int();
+  options.improve_neighbors = reader.Int();
+  options.improve_threads = reader.Int();
+  options.first_solution_strategy = reader.Bytes(reader.Int());
+  if (!reader.ok()) {
+    return EncodeResult(invalid);
+  }
+  return EncodeResult(SolveProblem(std::move(problem), options));
+}
+} // namespace constraint_solver
@@ -0,0 +1,61 @@
+#ifndef SOLVE_H
+#define SOLVE_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace constraint_solver {
+// Complete description of a routing problem, built by the caller in one go.
+struct ProblemSpec {
+  int num_nodes = 0;
+  int num_vehicles = 0;
+  int depot = 0;
+  // Row-major num_nodes x num_nodes integral distances.
+  std::vector<int64_t> distance_matrix;
+  // Optional per-vehicle start and end nodes; empty means depot.
+  std::vector<int64_t> starts;
+  std::vector<int64_t> ends;
+  // Maximum distance of a route; 0 adds no distance dimension.
+  int64_t max_route_distance = 0;
+};
+
+struct SolveOptions {
+  std::string first_solution_strategy = "AUTOMATIC";
+  // 0 keeps the OR-tools default (no limit).
+  int64_t time_limit_ms = 0;
+  bool deterministic = false;
+  int32_t seed = 0;
+  // Replaces the time limit in deterministic mode; must then be positive.
+  int64_t solution_limit = 0;
+  // Neighbors per node for the post-solve route improvement; 0 disables it.
+  int improve_neighbors = 0;
+  int improve_threads = 0;
+};
+
+struct SolveResult {
+  enum Status { kInvalid = -1, kNoSolution = 0, kSolved = 1 };
+  Status status = kNoSolution;
+  int64_t objective = 0;
+  // Nodes of every vehicle, start and end included.
+  std::vector<std::vector<int64_t>> routes;
+};
+
+// Builds the model, solves it and extracts the routes without any round trip
+// to the caller.
+SolveResult Solve(const ProblemSpec &problem, const SolveOptions &options);
+
+// Solve over a single flat little-endian buffer of size bytes, so that a Go
+// caller crosses cgo once per solve and its byte slice is read in place. The
+// request is a sequence of int64 words:
+//   version (1), num_nodes, num_vehicles, depot, max_route_distance,
+//   num_starts (0 or num_vehicles), starts, ends,
+//   distance_matrix (num_nodes * num_nodes),
+//   time_limit_ms, deterministic, seed, solution_limit,
+//   improve_neighbors, improve_threads, strategy_length,
+// followed by strategy_length bytes naming the first solution strategy.
+// The response is a sequence of int64 words:
+//   status, objective, num_routes, then per route its length and its nodes.
+std::string SolveBuffer(const char *request, int64_t size);
+} // namespace constraint_solver
+
+#endif
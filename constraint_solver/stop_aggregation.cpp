@@ -0,0 +1,116 @@
+#include "stop_aggregation.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+// Union-find whose sets carry the sum of their members' weights.
+class DisjointSets {
+public:
+  DisjointSets(int size, const std::vector<int64_t> &weights,
+               int64_t max_weight)
+      : parent(size), max_weight(max_weight) {
+    std::iota(parent.begin(), parent.end(), 0);
+    if (weights.empty()) {
+      weight.assign(size, 0);
+    } else {
+      weight = weights;
+    }
+  }
+
+  int Find(int node) {
+    while (parent[node] != node) {
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+    }
+    return node;
+  }
+  // Merges the sets of a and b unless their total weight would exceed
+  // max_weight.
+  void Union(int a, int b) {
+    a = Find(a);
+    b = Find(b);
+    if (a == b || weight[a] > max_weight - weight[b]) {
+      return;
+    }
+    // The smaller node stays the root, which keeps groups ordered.
+    const int root = std::min(a, b);
+    parent[std::max(a, b)] = root;
+    weight[root] = weight[a] + weight[b];
+  }
+
+private:
+  std::vector<int> parent;
+  std::vector<int64_t> weight;
+  const int64_t max_weight;
+};
+} // namespace
+
+StopGroups FindColocatedStops(const FlatMatrix &matrix,
+                              const std::vector<double> &longitudes,
+                              const std::vector<double> &latitudes,
+                              const std::vector<int32_t> &node_zones,
+                              const std::vector<int64_t> &demands,
+                              int64_t max_group_demand,
+                              const std::vector<bool> &fixed) {
+  const int num_nodes = matrix.size();
+  auto can_merge = [&](int a, int b) {
+    return !fixed[a] && !fixed[b] &&
+           (node_zones.empty() || node_zones[a] == node_zones[b]);
+  };
+  DisjointSets sets(num_nodes, demands, max_group_demand);
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = from + 1; to < num_nodes; ++to) {
+      if (matrix(from, to) == 0 && matrix(to, from) == 0 &&
+          can_merge(from, to)) {
+        sets.Union(from, to);
+      }
+    }
+  }
+  if (!longitudes.empty()) {
+    // Nodes sorted by position, so identical coordinates are adjacent.
+    std::vector<int> order(num_nodes);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return std::make_pair(longitudes[a], latitudes[a]) <
+             std::make_pair(longitudes[b], latitudes[b]);
+    });
+    for (int i = 0; i < num_nodes; ++i) {
+      for (int j = i + 1; j < num_nodes &&
+                          longitudes[order[j]] == longitudes[order[i]] &&
+                          latitudes[order[j]] == latitudes[order[i]];
+           ++j) {
+        if (can_merge(order[i], order[j])) {
+          sets.Union(order[i], order[j]);
+        }
+      }
+    }
+  }
+
+  StopGroups groups;
+  groups.node_group.resize(num_nodes);
+  for (int node = 0; node < num_nodes; ++node) {
+    const int root = sets.Find(node);
+    if (root == node) {
+      groups.node_group[node] = groups.group_nodes.size();
+      groups.group_nodes.emplace_back();
+    } else {
+      groups.node_group[node] = groups.node_group[root];
+    }
+    groups.group_nodes[groups.node_group[node]].push_back(node);
+  }
+  return groups;
+}
+
+std::vector<int64_t> SumByGroup(const StopGroups &groups,
+                                const std::vector<int64_t> &values) {
+  std::vector<int64_t> sums(groups.group_nodes.size(), 0);
+  for (size_t node = 0; node < values.size(); ++node) {
+    sums[groups.node_group[node]] += values[node];
+  }
+  return sums;
+}
+} // namespace constraint_solver
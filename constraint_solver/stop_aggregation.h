@@ -0,0 +1,38 @@
+#ifndef STOP_AGGREGATION_H
+#define STOP_AGGREGATION_H
+#include <cstdint>
+#include <vector>
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+// Partition of the nodes into groups of co-located stops.
+struct StopGroups {
+  // Group of every node. Groups are numbered in the order of their smallest
+  // node.
+  std::vector<int> node_group;
+  // Nodes of every group in increasing order; the first one represents the
+  // group in the reduced matrix.
+  std::vector<std::vector<int>> group_nodes;
+};
+
+// Groups the nodes at distance 0 from each other in both directions, and
+// those with identical coordinates when longitudes and latitudes are not
+// empty. Nodes flagged in fixed (depots, starts and ends) stay alone, and
+// with node_zones only nodes of the same zone are grouped. With demands, a
+// merge that would bring a group past max_group_demand is skipped, leaving
+// the location split over several groups.
+StopGroups FindColocatedStops(const FlatMatrix &matrix,
+                              const std::vector<double> &longitudes,
+                              const std::vector<double> &latitudes,
+                              const std::vector<int32_t> &node_zones,
+                              const std::vector<int64_t> &demands,
+                              int64_t max_group_demand,
+                              const std::vector<bool> &fixed);
+
+// Per-group sums of per-node values such as demands and service times.
+std::vector<int64_t> SumByGroup(const StopGroups &groups,
+                                const std::vector<int64_t> &values);
+} // namespace constraint_solver
+
+#endif
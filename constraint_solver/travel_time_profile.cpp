@@ -0,0 +1,231 @@
+#include "travel_time_profile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace constraint_solver {
+namespace {
+// Splits [first, last] at the profile breakpoints, moved earlier by offset
+// since the profile is read offset after the queried time. The transit is
+// monotone between two consecutive bounds, which is what the range queries
+// rely on. Reads the breakpoints in place, so range queries do not allocate.
+class PieceBounds {
+public:
+  PieceBounds(const TravelTimeProfile &profile, int64_t first, int64_t last,
+              int64_t offset)
+      : first(first), last(last), offset(offset) {
+    const std::vector<int64_t> &breakpoints = profile.breakpoints;
+    const auto begin = std::upper_bound(
+        breakpoints.begin(), breakpoints.end(), first,
+        [offset](int64_t value, int64_t breakpoint) {
+          return value < breakpoint - offset;
+        });
+    const auto end = std::lower_bound(
+        begin, breakpoints.end(), last,
+        [offset](int64_t breakpoint, int64_t value) {
+          return breakpoint - offset < value;
+        });
+    inner = breakpoints.data() + (begin - breakpoints.begin());
+    num_inner = end - begin;
+  }
+
+  size_t size() const { return num_inner + 2; }
+  int64_t operator[](size_t i) const {
+    if (i == 0) {
+      return first;
+    }
+    return i <= num_inner ? inner[i - 1] - offset : last;
+  }
+
+private:
+  const int64_t first;
+  const int64_t last;
+  const int64_t offset;
+  // Breakpoints strictly inside (first, last) after the offset.
+  const int64_t *inner;
+  size_t num_inner;
+};
+
+// Returns the first x in [a, b] for which the monotone (false then true)
+// predicate holds, or b + 1.
+template <typename Predicate>
+int64_t FirstTrue(int64_t a, int64_t b, const Predicate &predicate) {
+  int64_t lo = a;
+  int64_t hi = b + 1;
+  while (lo < hi) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    if (predicate(mid)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+} // namespace
+
+double TravelTimeProfile::FactorAt(int64_t departure) const {
+  if (breakpoints.empty()) {
+    return 1.0;
+  }
+  if (departure <= breakpoints.front()) {
+    return factors.front();
+  }
+  if (departure >= breakpoints.back()) {
+    return factors.back();
+  }
+  const size_t next =
+      std::upper_bound(breakpoints.begin(), breakpoints.end(), departure) -
+      breakpoints.begin();
+  const double weight =
+      static_cast<double>(departure - breakpoints[next - 1]) /
+      static_cast<double>(breakpoints[next] - breakpoints[next - 1]);
+  return factors[next - 1] + weight * (factors[next] - factors[next - 1]);
+}
+
+TravelTimeProfileTable::TravelTimeProfileTable() {
+  profiles.emplace_back();
+  ids[{{}, {}}] = 0;
+}
+
+int TravelTimeProfileTable::Add(std::vector<int64_t> breakpoints,
+                                std::vector<double> factors) {
+  if (breakpoints.size() != factors.size() ||
+      std::adjacent_find(breakpoints.begin(), breakpoints.end(),
+                         std::greater_equal<int64_t>()) != breakpoints.end() ||
+      std::any_of(factors.begin(), factors.end(),
+                  [](double factor) { return factor < 0; })) {
+    return -1;
+  }
+  auto key = std::make_pair(std::move(breakpoints), std::move(factors));
+  auto it = ids.find(key);
+  if (it != ids.end()) {
+    return it->second;
+  }
+  if (size() >= kMaxProfiles) {
+    return -1;
+  }
+  const int id = profiles.size();
+  profiles.push_back({key.first, key.second});
+  ids.emplace(std::move(key), id);
+  return id;
+}
+
+int64_t TimeDependentTransit::Query(int64_t arrival) const {
+  const double factor = profile->FactorAt(arrival + service_time);
+  return service_time + std::max<int64_t>(0, std::llround(base_time * factor));
+}
+
+int64_t TimeDependentTransit::RangeMax(int64_t from, int64_t to) const {
+  int64_t result = Query(from);
+  const PieceBounds bounds(*profile, from, std::max(from, to - 1),
+                           service_time);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const int64_t bound = bounds[i];
+    result = std::max(result, Query(bound));
+  }
+  return result;
+}
+
+int64_t TimeDependentTransit::RangeMin(int64_t from, int64_t to) const {
+  int64_t result = Query(from);
+  const PieceBounds bounds(*profile, from, std::max(from, to - 1),
+                           service_time);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const int64_t bound = bounds[i];
+    result = std::min(result, Query(bound));
+  }
+  return result;
+}
+
+int64_t TimeDependentTransit::RangeFirstInsideInterval(
+    int64_t range_begin, int64_t range_end, int64_t interval_begin,
+    int64_t interval_end, int64_t default_value) const {
+  if (range_end <= range_begin || interval_end <= interval_begin) {
+    return default_value;
+  }
+  const PieceBounds bounds(*profile, range_begin, range_end - 1,
+                           service_time);
+  for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+    const int64_t a = bounds[i];
+    const int64_t b = bounds[i + 1];
+    int64_t x;
+    if (Query(a) <= Query(b)) {
+      x = FirstTrue(a, b, [this, interval_begin](int64_t t) {
+        return Query(t) >= interval_begin;
+      });
+    } else {
+      x = FirstTrue(a, b, [this, interval_end](int64_t t) {
+        return Query(t) < interval_end;
+      });
+    }
+    if (x <= b && Query(x) >= interval_begin && Query(x) < interval_end) {
+      return x;
+    }
+  }
+  return default_value;
+}
+
+int64_t TimeDependentTransit::RangeLastInsideInterval(
+    int64_t range_begin, int64_t range_end, int64_t interval_begin,
+    int64_t interval_end, int64_t default_value) const {
+  if (range_end <= range_begin || interval_end <= interval_begin) {
+    return default_value;
+  }
+  const PieceBounds bounds(*profile, range_begin, range_end - 1,
+                           service_time);
+  for (size_t i = bounds.size() - 1; i > 0; --i) {
+    const int64_t a = bounds[i - 1];
+    const int64_t b = bounds[i];
+    int64_t x;
+    if (Query(a) <= Query(b)) {
+      x = FirstTrue(a, b, [this, interval_end](int64_t t) {
+            return Query(t) >= interval_end;
+          }) - 1;
+    } else {
+      x = FirstTrue(a, b, [this, interval_begin](int64_t t) {
+            return Query(t) < interval_begin;
+          }) - 1;
+    }
+    if (x >= a && Query(x) >= interval_begin && Query(x) < interval_end) {
+      return x;
+    }
+  }
+  return default_value;
+}
+
+int64_t TimeDependentArrival::Query(int64_t arrival) const {
+  return arrival + transit.Query(arrival);
+}
+
+int64_t TimeDependentArrival::RangeMaxArgument(int64_t from,
+                                               int64_t to) const {
+  int64_t best = from;
+  const PieceBounds bounds(*profile, from, std::max(from, to - 1),
+                           service_time);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const int64_t bound = bounds[i];
+    if (Query(bound) > Query(best)) {
+      best = bound;
+    }
+  }
+  return best;
+}
+
+int64_t TimeDependentArrival::RangeMinArgument(int64_t from,
+                                               int64_t to) const {
+  int64_t best = from;
+  const PieceBounds bounds(*profile, from, std::max(from, to - 1),
+                           service_time);
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    const int64_t bound = bounds[i];
+    if (Query(bound) < Query(best)) {
+      best = bound;
+    }
+  }
+  return best;
+}
+} // namespace constraint_solver
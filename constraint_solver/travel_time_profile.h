@@ -0,0 +1,94 @@
+#ifndef TRAVEL_TIME_PROFILE_H
+#define TRAVEL_TIME_PROFILE_H
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "ortools/util/range_query_function.h"
+
+namespace constraint_solver {
+// Piecewise-linear multiplier applied to a base travel time depending on the
+// departure time. factors[i] holds at breakpoints[i]; the first and last
+// factors extend to -inf and +inf. An empty profile is the constant 1.
+struct TravelTimeProfile {
+  std::vector<int64_t> breakpoints;
+  std::vector<double> factors;
+
+  double FactorAt(int64_t departure) const;
+};
+
+// Deduplicated set of profiles. Profile 0 is always the constant profile, so
+// arcs without traffic data cost one id and no profile memory. Ids fit in 16
+// bits so that per-arc references stay a quarter of an int64 matrix.
+class TravelTimeProfileTable {
+public:
+  TravelTimeProfileTable();
+
+  static constexpr int kMaxProfiles = 1 << 16;
+
+  // Returns the id of the profile, adding it if no identical profile exists,
+  // or -1 if breakpoints are not strictly increasing, the sizes differ, a
+  // factor is negative or the table is full.
+  int Add(std::vector<int64_t> breakpoints, std::vector<double> factors);
+  const TravelTimeProfile &Get(int id) const { return profiles[id]; }
+  int size() const { return profiles.size(); }
+
+private:
+  // Deque so references handed to transits survive later additions.
+  std::deque<TravelTimeProfile> profiles;
+  std::map<std::pair<std::vector<int64_t>, std::vector<double>>, int> ids;
+};
+
+// Transit of one arc as a function of the arrival time at its tail, as
+// consumed by RoutingModel state-dependent transits: the service time at the
+// tail, then the travel time at the departure that follows it. Holds a
+// pointer to the shared profile instead of a copy, but the routing model
+// still caches one transit and one arrival object per arc, about 100 bytes
+// and two heap allocations per arc including allocator overhead.
+class TimeDependentTransit
+    : public operations_research::RangeIntToIntFunction {
+public:
+  TimeDependentTransit(const TravelTimeProfile *profile, int64_t base_time,
+                       int64_t service_time)
+      : profile(profile), base_time(base_time), service_time(service_time) {}
+
+  int64_t Query(int64_t departure) const override;
+  int64_t RangeMax(int64_t from, int64_t to) const override;
+  int64_t RangeMin(int64_t from, int64_t to) const override;
+  int64_t RangeFirstInsideInterval(int64_t range_begin, int64_t range_end,
+                                   int64_t interval_begin,
+                                   int64_t interval_end,
+                                   int64_t default_value) const override;
+  int64_t RangeLastInsideInterval(int64_t range_begin, int64_t range_end,
+                                  int64_t interval_begin, int64_t interval_end,
+                                  int64_t default_value) const override;
+
+private:
+  const TravelTimeProfile *profile;
+  int64_t base_time;
+  int64_t service_time;
+};
+
+// Arrival time at the head of one arc (arrival at the tail plus transit).
+class TimeDependentArrival
+    : public operations_research::RangeMinMaxIndexFunction {
+public:
+  TimeDependentArrival(const TravelTimeProfile *profile, int64_t base_time,
+                       int64_t service_time)
+      : profile(profile), service_time(service_time),
+        transit(profile, base_time, service_time) {}
+
+  int64_t Query(int64_t departure) const override;
+  int64_t RangeMaxArgument(int64_t from, int64_t to) const override;
+  int64_t RangeMinArgument(int64_t from, int64_t to) const override;
+
+private:
+  const TravelTimeProfile *profile;
+  int64_t service_time;
+  TimeDependentTransit transit;
+};
+} // namespace constraint_solver
+
+#endif
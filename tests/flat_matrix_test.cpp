@@ -0,0 +1,61 @@
+#include "flat_matrix.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace constraint_solver {
+namespace {
+TEST(FlatMatrixTest, ConvertsNestedMatrixByTruncation) {
+  const FlatMatrix matrix({{0, 1.9, 2.5}, {3.2, 0, 4.99}, {5, 6.5, 0}});
+  ASSERT_EQ(matrix.size(), 3);
+  EXPECT_EQ(matrix(0, 1), 1);
+  EXPECT_EQ(matrix(0, 2), 2);
+  EXPECT_EQ(matrix(1, 0), 3);
+  EXPECT_EQ(matrix(1, 2), 4);
+  EXPECT_EQ(matrix(2, 1), 6);
+  EXPECT_EQ(matrix.Wide(2, 0), 5);
+}
+
+TEST(FlatMatrixTest, CompactKeepsValuesInHalfTheBytes) {
+  FlatMatrix matrix(2, {0, std::numeric_limits<int32_t>::max(),
+                        std::numeric_limits<int32_t>::min(), 7});
+  const int64_t wide_bytes = matrix.ByteSize();
+  EXPECT_EQ(wide_bytes, 4 * 8);
+  ASSERT_TRUE(matrix.Compact());
+  EXPECT_TRUE(matrix.compact());
+  EXPECT_EQ(matrix.ByteSize(), 4 * 4);
+  EXPECT_EQ(matrix.Narrow(0, 1), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(matrix(1, 0), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(matrix(1, 1), 7);
+  // Compacting again is a no-op that still reports 32-bit storage.
+  EXPECT_TRUE(matrix.Compact());
+  EXPECT_EQ(matrix(0, 1), std::numeric_limits<int32_t>::max());
+}
+
+TEST(FlatMatrixTest, CompactRefusesValuesOutsideInt32) {
+  const int64_t too_large = int64_t{std::numeric_limits<int32_t>::max()} + 1;
+  FlatMatrix matrix(2, {0, 1, too_large, 0});
+  EXPECT_FALSE(matrix.Compact());
+  EXPECT_FALSE(matrix.compact());
+  EXPECT_EQ(matrix.ByteSize(), 4 * 8);
+  EXPECT_EQ(matrix(1, 0), too_large);
+  EXPECT_EQ(matrix.Row(1)[0], too_large);
+
+  FlatMatrix negative(1, {int64_t{std::numeric_limits<int32_t>::min()} - 1});
+  EXPECT_FALSE(negative.Compact());
+}
+
+TEST(FlatMatrixTest, ResizeDropsCompactStorage) {
+  FlatMatrix matrix(2, {1, 2, 3, 4});
+  ASSERT_TRUE(matrix.Compact());
+  matrix.Resize(3);
+  EXPECT_FALSE(matrix.compact());
+  EXPECT_EQ(matrix.size(), 3);
+  EXPECT_EQ(matrix(2, 2), 0);
+  matrix.Row(2)[1] = 9;
+  EXPECT_EQ(matrix(2, 1), 9);
+}
+} // namespace
+} // namespace constraint_solver
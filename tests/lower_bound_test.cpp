@@ -0,0 +1,134 @@
+#include "lower_bound.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+namespace {
+// Cheapest set of between min_vehicles and max_vehicles non-empty routes
+// from and to depot that visit every other node once, by enumeration.
+int64_t OptimalRoutes(const FlatMatrix &matrix, int depot, int min_vehicles,
+                      int max_vehicles) {
+  std::vector<int> customers;
+  for (int node = 0; node < matrix.size(); ++node) {
+    if (node != depot) {
+      customers.push_back(node);
+    }
+  }
+  const int num_customers = customers.size();
+  int64_t best = std::numeric_limits<int64_t>::max();
+  do {
+    // Bit i of cuts ends a route after customers[i].
+    for (int cuts = 0; cuts < 1 << (num_customers - 1); ++cuts) {
+      const int routes = 1 + __builtin_popcount(cuts);
+      if (routes < min_vehicles || routes > max_vehicles) {
+        continue;
+      }
+      int64_t cost = matrix(depot, customers[0]);
+      for (int i = 1; i < num_customers; ++i) {
+        if (cuts >> (i - 1) & 1) {
+          cost += matrix(customers[i - 1], depot) +
+                  matrix(depot, customers[i]);
+        } else {
+          cost += matrix(customers[i - 1], customers[i]);
+        }
+      }
+      cost += matrix(customers.back(), depot);
+      best = std::min(best, cost);
+    }
+  } while (std::next_permutation(customers.begin(), customers.end()));
+  return best;
+}
+
+FlatMatrix RandomMatrix(int num_nodes, bool symmetric, uint32_t seed) {
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> coordinate(0, 100);
+  std::vector<double> x(num_nodes), y(num_nodes);
+  for (int node = 0; node < num_nodes; ++node) {
+    x[node] = coordinate(random);
+    y[node] = coordinate(random);
+  }
+  std::uniform_int_distribution<int> detour(0, 30);
+  FlatMatrix matrix;
+  matrix.Resize(num_nodes);
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = 0; to < num_nodes; ++to) {
+      matrix.Row(from)[to] =
+          from == to ? 0
+                     : std::lround(std::hypot(x[from] - x[to],
+                                              y[from] - y[to])) +
+                           (symmetric ? 0 : detour(random));
+    }
+  }
+  return matrix;
+}
+
+TEST(MinVehiclesForCapacityTest, FillsLargestVehiclesFirst) {
+  EXPECT_EQ(MinVehiclesForCapacity({3, 4, 5}, {5, 5, 10, 5}), 2);
+  EXPECT_EQ(MinVehiclesForCapacity({3, 4, 5}, {12}), 1);
+  // Negative demands, e.g. of deliveries, free no capacity.
+  EXPECT_EQ(MinVehiclesForCapacity({6, -6, 6}, {6, 6, 6}), 2);
+  EXPECT_EQ(MinVehiclesForCapacity({0, 0}, {1}), 0);
+  EXPECT_EQ(MinVehiclesForCapacity({}, {}), 0);
+}
+
+TEST(MinVehiclesForCapacityTest, ReportsInsufficientFleet) {
+  EXPECT_EQ(MinVehiclesForCapacity({5, 5, 5}, {7, 7}), -1);
+  EXPECT_EQ(MinVehiclesForCapacity({1}, {}), -1);
+}
+
+TEST(RouteDistanceLowerBoundTest, IsTightOnLine) {
+  // Depot at x = 0 and customers at x = 1..4: one route there and back.
+  FlatMatrix matrix;
+  matrix.Resize(5);
+  for (int from = 0; from < 5; ++from) {
+    for (int to = 0; to < 5; ++to) {
+      matrix.Row(from)[to] = std::abs(from - to);
+    }
+  }
+  EXPECT_EQ(RouteDistanceLowerBound(matrix, 0, 1, 3, 0, 1), 8);
+  EXPECT_EQ(RouteDistanceLowerBound(matrix, 0, 1, 3, 8, 2), 8);
+}
+
+TEST(RouteDistanceLowerBoundTest, NeverExceedsOptimum) {
+  for (uint32_t seed = 1; seed <= 6; ++seed) {
+    for (bool symmetric : {true, false}) {
+      const FlatMatrix matrix = RandomMatrix(7, symmetric, seed);
+      for (int min_vehicles : {1, 2, 3}) {
+        const int64_t optimum = OptimalRoutes(matrix, 0, min_vehicles, 3);
+        const int64_t single = RouteDistanceLowerBound(
+            matrix, 0, min_vehicles, 3, optimum, 1);
+        const int64_t parallel = RouteDistanceLowerBound(
+            matrix, 0, min_vehicles, 3, optimum, 4);
+        EXPECT_LE(single, optimum) << "seed " << seed;
+        EXPECT_LE(parallel, optimum) << "seed " << seed;
+        // Run 0 of the threads is the single-threaded run.
+        EXPECT_GE(parallel, single) << "seed " << seed;
+        if (symmetric) {
+          // Loose: the relaxation is usually within a few percent.
+          EXPECT_GE(parallel, optimum * 0.8) << "seed " << seed;
+        }
+      }
+    }
+  }
+}
+
+TEST(RouteDistanceLowerBoundTest, HandlesDegenerateInputs) {
+  FlatMatrix single(1, {0});
+  EXPECT_EQ(RouteDistanceLowerBound(single, 0, 1, 1, 0, 1), 0);
+  FlatMatrix pair(2, {0, 5, 7, 0});
+  EXPECT_EQ(RouteDistanceLowerBound(pair, 0, 1, 0, 0, 1), 0);
+  EXPECT_EQ(RouteDistanceLowerBound(pair, 0, 1, 1, 0, 1), 10);
+  FlatMatrix negative(2, {0, -1, -1, 0});
+  EXPECT_EQ(RouteDistanceLowerBound(negative, 0, 1, 1, 0, 1), 0);
+}
+} // namespace
+} // namespace constraint_solver
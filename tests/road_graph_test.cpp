@@ -0,0 +1,242 @@
+#include "road_graph.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace constraint_solver {
+namespace {
+RoadGraph MakeGraph(int num_vertices,
+                    std::vector<std::tuple<int32_t, int32_t, int64_t>> arcs) {
+  std::sort(arcs.begin(), arcs.end());
+  RoadGraph graph;
+  graph.offsets.assign(num_vertices + 1, 0);
+  for (const auto &[from, to, weight] : arcs) {
+    ++graph.offsets[from + 1];
+    graph.targets.push_back(to);
+    graph.weights.push_back(weight);
+  }
+  for (int vertex = 0; vertex < num_vertices; ++vertex) {
+    graph.offsets[vertex + 1] += graph.offsets[vertex];
+  }
+  return graph;
+}
+
+// 0 -> 2 -> 1 -> 3 -> 0 is the cheap cycle; 0 -> 1 and 2 -> 3 are shortcuts
+// that do not pay. Vertex 4 has no arcs.
+RoadGraph SmallGraph() {
+  return MakeGraph(5, {{0, 1, 4},
+                       {0, 2, 1},
+                       {2, 1, 2},
+                       {1, 3, 1},
+                       {2, 3, 5},
+                       {3, 0, 3}});
+}
+
+// Shortest distances of SmallGraph between vertices 0..3, by hand.
+const int64_t kSmallDistances[4][4] = {
+    {0, 3, 1, 4}, {4, 0, 5, 1}, {6, 2, 0, 3}, {3, 6, 4, 0}};
+
+TEST(RoadGraphTest, ValidatesStructure) {
+  EXPECT_TRUE(SmallGraph().IsValid());
+  RoadGraph bad_target = SmallGraph();
+  bad_target.targets[0] = 5;
+  EXPECT_FALSE(bad_target.IsValid());
+  RoadGraph negative_weight = SmallGraph();
+  negative_weight.weights[2] = -1;
+  EXPECT_FALSE(negative_weight.IsValid());
+  RoadGraph decreasing = SmallGraph();
+  std::swap(decreasing.offsets[1], decreasing.offsets[2]);
+  EXPECT_FALSE(decreasing.IsValid());
+}
+
+TEST(RoadGraphTest, LoadsBinaryFile) {
+  const RoadGraph graph = SmallGraph();
+  const std::string path = testing::TempDir() + "/small_graph.bin";
+  {
+    std::ofstream file(path, std::ios::binary);
+    const int64_t header[2] = {graph.num_vertices(),
+                               static_cast<int64_t>(graph.targets.size())};
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(graph.offsets.data()),
+               graph.offsets.size() * sizeof(int64_t));
+    file.write(reinterpret_cast<const char *>(graph.targets.data()),
+               graph.targets.size() * sizeof(int32_t));
+    file.write(reinterpret_cast<const char *>(graph.weights.data()),
+               graph.weights.size() * sizeof(int64_t));
+  }
+  RoadGraph loaded;
+  ASSERT_TRUE(LoadRoadGraph(path, &loaded));
+  EXPECT_EQ(loaded.offsets, graph.offsets);
+  EXPECT_EQ(loaded.targets, graph.targets);
+  EXPECT_EQ(loaded.weights, graph.weights);
+
+  // A truncated file fails the size check and leaves the graph alone.
+  std::ifstream in(path, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+  std::ofstream(path, std::ios::binary)
+      .write(bytes.data(), bytes.size() - 1);
+  EXPECT_FALSE(LoadRoadGraph(path, &loaded));
+  EXPECT_EQ(loaded.targets, graph.targets);
+  EXPECT_FALSE(LoadRoadGraph(path + ".missing", &loaded));
+}
+
+TEST(ShortestPathSearchTest, MatchesHandComputedDistances) {
+  const RoadGraph graph = SmallGraph();
+  ShortestPathSearch search(graph);
+  const std::vector<int32_t> targets = {0, 1, 2, 3};
+  // Repeated runs reuse the stamped state.
+  for (int round = 0; round < 2; ++round) {
+    for (int32_t source = 0; source < 4; ++source) {
+      std::vector<int64_t> distances(targets.size());
+      search.Run(source, targets, distances.data());
+      for (int32_t target = 0; target < 4; ++target) {
+        EXPECT_EQ(distances[target], kSmallDistances[source][target])
+            << source << " -> " << target;
+      }
+    }
+  }
+}
+
+TEST(ShortestPathSearchTest, ReportsUnreachableTargets) {
+  const RoadGraph graph = SmallGraph();
+  ShortestPathSearch search(graph);
+  int64_t distances[3];
+  search.Run(0, {4, 3, 4}, distances);
+  EXPECT_EQ(distances[0], kUnreachableDistance);
+  EXPECT_EQ(distances[1], 4);
+  EXPECT_EQ(distances[2], kUnreachableDistance);
+  search.Run(4, {4, 0}, distances);
+  EXPECT_EQ(distances[0], 0);
+  EXPECT_EQ(distances[1], kUnreachableDistance);
+}
+
+TEST(BuildDistanceMatrixTest, MatchesSearchForAnyThreadCount) {
+  const RoadGraph graph = SmallGraph();
+  // Vertex 4 is unreachable and vertex 1 appears twice.
+  const std::vector<int32_t> vertices = {3, 1, 4, 0, 1};
+  const int num_nodes = vertices.size();
+  for (int num_threads : {1, 2, 5, 16, 0}) {
+    FlatMatrix matrix;
+    BuildDistanceMatrix(graph, vertices, num_threads, &matrix);
+    ASSERT_EQ(matrix.size(), num_nodes);
+    for (int from = 0; from < num_nodes; ++from) {
+      for (int to = 0; to < num_nodes; ++to) {
+        int64_t expected;
+        if (vertices[from] == vertices[to]) {
+          expected = 0;
+        } else if (vertices[from] == 4 || vertices[to] == 4) {
+          expected = kUnreachableDistance;
+        } else {
+          expected = kSmallDistances[vertices[from]][vertices[to]];
+        }
+        EXPECT_EQ(matrix(from, to), expected)
+            << num_threads << " threads, " << from << " -> " << to;
+      }
+    }
+  }
+}
+
+TEST(BuildDistanceMatrixTest, HandlesNoNodes) {
+  FlatMatrix matrix;
+  BuildDistanceMatrix(SmallGraph(), {}, 4, &matrix);
+  EXPECT_EQ(matrix.size(), 0);
+}
+
+TEST(LazyDistanceOracleTest, EvictsRowsInClockOrder) {
+  LazyDistanceOracle oracle(std::make_shared<RoadGraph>(SmallGraph()),
+                            {0, 1, 2, 3}, 2);
+  auto query = [&oracle](int from) {
+    EXPECT_EQ(oracle.Distance(from, 3), kSmallDistances[from][3]);
+    return oracle.rows_computed();
+  };
+  EXPECT_EQ(query(0), 1);
+  EXPECT_EQ(query(1), 2);
+  EXPECT_EQ(query(0), 2);
+  // Both slots are referenced: the hand clears them and evicts row 0.
+  EXPECT_EQ(query(2), 3);
+  EXPECT_EQ(query(1), 3);
+  // Both referenced again; the hand starts at row 1's slot, so row 1 goes.
+  EXPECT_EQ(query(0), 4);
+  EXPECT_EQ(query(2), 4);
+  EXPECT_EQ(query(1), 5);
+  for (int from = 0; from < 4; ++from) {
+    for (int to = 0; to < 4; ++to) {
+      EXPECT_EQ(oracle.Distance(from, to), kSmallDistances[from][to]);
+    }
+  }
+}
+
+TEST(LazyDistanceOracleTest, ConcurrentReadersSeeConsistentRows) {
+  // Grid with one-way streets, so rows differ and are asymmetric.
+  constexpr int kSide = 12;
+  std::vector<std::tuple<int32_t, int32_t, int64_t>> arcs;
+  for (int y = 0; y < kSide; ++y) {
+    for (int x = 0; x < kSide; ++x) {
+      const int vertex = y * kSide + x;
+      if (x + 1 < kSide) {
+        arcs.emplace_back(vertex, vertex + 1, 1 + (x + y) % 3);
+      }
+      if (x > 0 && y % 2 == 0) {
+        arcs.emplace_back(vertex, vertex - 1, 2);
+      }
+      if (y + 1 < kSide) {
+        arcs.emplace_back(vertex, vertex + kSide, 1 + x % 4);
+      }
+      if (y > 0) {
+        arcs.emplace_back(vertex, vertex - kSide, 3);
+      }
+    }
+  }
+  auto graph =
+      std::make_shared<RoadGraph>(MakeGraph(kSide * kSide, std::move(arcs)));
+  std::vector<int32_t> vertices;
+  for (int vertex = 0; vertex < kSide * kSide; vertex += 5) {
+    vertices.push_back(vertex);
+  }
+  const int num_nodes = vertices.size();
+  std::vector<int64_t> expected(num_nodes * num_nodes);
+  ShortestPathSearch search(*graph);
+  for (int from = 0; from < num_nodes; ++from) {
+    search.Run(vertices[from], vertices, expected.data() + from * num_nodes);
+  }
+
+  // Three slots for 29 rows keep the threads evicting each other's rows.
+  LazyDistanceOracle oracle(graph, vertices, 3);
+  std::vector<int> mismatches(4, 0);
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([&, thread]() {
+      std::mt19937 random(thread);
+      std::uniform_int_distribution<int> node(0, num_nodes - 1);
+      for (int i = 0; i < 2000; ++i) {
+        // Runs of hits on one row between misses.
+        const int from = node(random);
+        for (int j = 0; j < 8; ++j) {
+          const int to = node(random);
+          if (oracle.Distance(from, to) != expected[from * num_nodes + to]) {
+            ++mismatches[thread];
+          }
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (int thread = 0; thread < 4; ++thread) {
+    EXPECT_EQ(mismatches[thread], 0) << "thread " << thread;
+  }
+  EXPECT_GT(oracle.rows_computed(), num_nodes);
+}
+} // namespace
+} // namespace constraint_solver
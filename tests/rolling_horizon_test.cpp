@@ -0,0 +1,120 @@
+#include "rolling_horizon.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace constraint_solver {
+namespace {
+// Depot 0 and the other nodes on a line at x = 10 * node.
+RollingHorizonPlanner LinePlanner(int num_nodes, int num_vehicles,
+                                  const RollingHorizonOptions &options) {
+  std::vector<int64_t> distances;
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = 0; to < num_nodes; ++to) {
+      distances.push_back(10 * std::abs(from - to));
+    }
+  }
+  return RollingHorizonPlanner(std::move(distances), num_nodes, num_vehicles,
+                               0, options);
+}
+
+RollingHorizonOptions TestOptions() {
+  RollingHorizonOptions options;
+  options.max_batch_orders = 3;
+  options.locked_visits = 1;
+  options.time_limit_ms = 200;
+  return options;
+}
+
+std::vector<int64_t> AllOpenVisits(const RollingHorizonPlanner &planner,
+                                   int num_vehicles) {
+  std::vector<int64_t> visits;
+  for (int vehicle = 0; vehicle < num_vehicles; ++vehicle) {
+    const std::vector<int64_t> open = planner.GetOpenVisits(vehicle);
+    visits.insert(visits.end(), open.begin(), open.end());
+  }
+  std::sort(visits.begin(), visits.end());
+  return visits;
+}
+
+TEST(RollingHorizonPlannerTest, KeepsLockedVisitsAcrossBatches) {
+  RollingHorizonPlanner planner = LinePlanner(10, 2, TestOptions());
+  ASSERT_TRUE(planner.IsValid());
+  for (int64_t node : {5, 6, 7}) {
+    ASSERT_TRUE(planner.QueueOrder(node));
+  }
+  ASSERT_TRUE(planner.ProcessBatch());
+  EXPECT_EQ(AllOpenVisits(planner, 2), (std::vector<int64_t>{5, 6, 7}));
+  EXPECT_EQ(planner.GetQueuedOrders(), 0);
+  std::vector<int64_t> heads(2, -1);
+  for (int vehicle = 0; vehicle < 2; ++vehicle) {
+    if (!planner.GetOpenVisits(vehicle).empty()) {
+      heads[vehicle] = planner.GetOpenVisits(vehicle).front();
+    }
+  }
+
+  // Unlocked, the orders near the depot would go first on the route; the
+  // second batch is the first one with locks to apply.
+  for (int64_t node : {1, 2}) {
+    ASSERT_TRUE(planner.QueueOrder(node));
+  }
+  ASSERT_TRUE(planner.ProcessBatch());
+  EXPECT_EQ(AllOpenVisits(planner, 2),
+            (std::vector<int64_t>{1, 2, 5, 6, 7}));
+  for (int vehicle = 0; vehicle < 2; ++vehicle) {
+    if (heads[vehicle] >= 0) {
+      ASSERT_FALSE(planner.GetOpenVisits(vehicle).empty());
+      EXPECT_EQ(planner.GetOpenVisits(vehicle).front(), heads[vehicle]);
+    }
+  }
+
+  // Committed visits leave the model, and the next head is locked instead.
+  const int vehicle = heads[0] >= 0 ? 0 : 1;
+  ASSERT_TRUE(planner.CommitVisits(vehicle, 1));
+  EXPECT_EQ(planner.GetCommittedVisits(vehicle),
+            (std::vector<int64_t>{heads[vehicle]}));
+  const std::vector<int64_t> tail = planner.GetOpenVisits(vehicle);
+  ASSERT_TRUE(planner.QueueOrder(9));
+  ASSERT_TRUE(planner.ProcessBatch());
+  EXPECT_EQ(planner.GetLastModelSize(), 1 + 2 + 4 + 1);
+  if (!tail.empty()) {
+    EXPECT_EQ(planner.GetOpenVisits(vehicle).front(), tail.front());
+  }
+  EXPECT_EQ(AllOpenVisits(planner, 2).size(), 5);
+}
+
+TEST(RollingHorizonPlannerTest, RespectsRemainingCapacity) {
+  RollingHorizonPlanner planner = LinePlanner(6, 1, TestOptions());
+  ASSERT_TRUE(planner.SetDemands({0, 1, 1, 1, 1, 1}, {3}));
+  for (int64_t node : {1, 2, 3}) {
+    ASSERT_TRUE(planner.QueueOrder(node));
+  }
+  ASSERT_TRUE(planner.ProcessBatch());
+  ASSERT_TRUE(planner.CommitVisits(0, 2));
+  // The unit left goes to the promised, locked visit 3; both new orders wait.
+  for (int64_t node : {4, 5}) {
+    ASSERT_TRUE(planner.QueueOrder(node));
+  }
+  ASSERT_TRUE(planner.ProcessBatch());
+  EXPECT_EQ(planner.GetOpenVisits(0).size(), 1);
+  EXPECT_EQ(planner.GetQueuedOrders(), 2);
+}
+
+TEST(RollingHorizonPlannerTest, RejectsInvalidInput) {
+  RollingHorizonPlanner invalid({0, 1, 1}, 2, 1, 0, TestOptions());
+  EXPECT_FALSE(invalid.IsValid());
+  EXPECT_FALSE(invalid.ProcessBatch());
+
+  RollingHorizonPlanner planner = LinePlanner(4, 1, TestOptions());
+  EXPECT_FALSE(planner.QueueOrder(0));
+  EXPECT_FALSE(planner.QueueOrder(4));
+  EXPECT_TRUE(planner.QueueOrder(2));
+  EXPECT_FALSE(planner.QueueOrder(2));
+  EXPECT_FALSE(planner.CommitVisits(0, 1));
+  EXPECT_FALSE(planner.SetDemands({0, 1}, {5}));
+}
+} // namespace
+} // namespace constraint_solver
@@ -0,0 +1,100 @@
+#include "route_improvement.h"
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+namespace {
+// Nodes on a line at x = node. Stepping backwards costs backward_factor
+// times the distance, so with a factor above 1 only increasing routes are
+// cheap and 2-opt reversals do not pay.
+FlatMatrix LineMatrix(int num_nodes, int64_t backward_factor) {
+  FlatMatrix matrix;
+  matrix.Resize(num_nodes);
+  for (int from = 0; from < num_nodes; ++from) {
+    int64_t *row = matrix.Row(from);
+    for (int to = 0; to < num_nodes; ++to) {
+      row[to] = to >= from ? to - from : backward_factor * (from - to);
+    }
+  }
+  return matrix;
+}
+
+int64_t RouteCost(const FlatMatrix &matrix, const std::vector<int64_t> &route) {
+  int64_t cost = 0;
+  for (size_t i = 1; i < route.size(); ++i) {
+    cost += matrix(route[i - 1], route[i]);
+  }
+  return cost;
+}
+
+TEST(ImproveRouteTest, TwoOptUncrossesSymmetricRoute) {
+  const FlatMatrix matrix = LineMatrix(5, 1);
+  // 0 -> 3 -> 2 -> 1 -> 4 -> 0 costs 3 + 1 + 1 + 3 + 4 = 12; reversing the
+  // middle gives 1 + 1 + 1 + 1 + 4 = 8.
+  std::vector<int64_t> route = {0, 3, 2, 1, 4, 0};
+  ASSERT_TRUE(ImproveRoute(matrix, 4, &route));
+  EXPECT_EQ(route, (std::vector<int64_t>{0, 1, 2, 3, 4, 0}));
+  EXPECT_EQ(RouteCost(matrix, route), 8);
+}
+
+TEST(ImproveRouteTest, OrOptMovesNodeOnAsymmetricRoute) {
+  const FlatMatrix matrix = LineMatrix(5, 10);
+  // 0 -> 2 -> 3 -> 1 -> 4 costs 2 + 1 + 20 + 3 = 26. Reversing any segment
+  // adds backward steps; moving node 1 after 0 gives the optimum, 4.
+  std::vector<int64_t> route = {0, 2, 3, 1, 4};
+  ASSERT_TRUE(ImproveRoute(matrix, 4, &route));
+  EXPECT_EQ(route, (std::vector<int64_t>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(RouteCost(matrix, route), 4);
+}
+
+TEST(ImproveRouteTest, KeepsEndpoints) {
+  const FlatMatrix matrix = LineMatrix(6, 3);
+  std::vector<int64_t> route = {5, 1, 4, 2, 3, 0};
+  const int64_t before = RouteCost(matrix, route);
+  ImproveRoute(matrix, 5, &route);
+  EXPECT_EQ(route.front(), 5);
+  EXPECT_EQ(route.back(), 0);
+  EXPECT_LE(RouteCost(matrix, route), before);
+}
+
+TEST(ImproveRouteTest, LeavesOptimalAndShortRoutesAlone) {
+  const FlatMatrix matrix = LineMatrix(5, 10);
+  std::vector<int64_t> optimal = {0, 1, 2, 3, 4};
+  EXPECT_FALSE(ImproveRoute(matrix, 4, &optimal));
+  EXPECT_EQ(optimal, (std::vector<int64_t>{0, 1, 2, 3, 4}));
+  std::vector<int64_t> short_route = {0, 2, 1};
+  EXPECT_FALSE(ImproveRoute(matrix, 4, &short_route));
+  EXPECT_EQ(short_route, (std::vector<int64_t>{0, 2, 1}));
+}
+
+TEST(ImproveRouteTest, RejectsNonPositiveNeighbors) {
+  const FlatMatrix matrix = LineMatrix(5, 10);
+  for (int num_neighbors : {0, -1}) {
+    std::vector<int64_t> route = {0, 2, 3, 1, 4};
+    EXPECT_FALSE(ImproveRoute(matrix, num_neighbors, &route));
+    EXPECT_EQ(route, (std::vector<int64_t>{0, 2, 3, 1, 4}));
+  }
+}
+
+TEST(ImproveRoutesTest, ThreadsMatchSingleThread) {
+  const FlatMatrix matrix = LineMatrix(8, 5);
+  const std::vector<std::vector<int64_t>> routes = {
+      {0, 3, 1, 2, 0}, {0, 7, 5, 6, 4, 0}, {0, 1, 0}, {0, 4, 6, 5, 7, 2, 0}};
+  std::vector<std::vector<int64_t>> single = routes;
+  std::vector<std::vector<int64_t>> parallel = routes;
+  EXPECT_TRUE(ImproveRoutes(matrix, 7, 1, &single));
+  EXPECT_TRUE(ImproveRoutes(matrix, 7, 3, &parallel));
+  EXPECT_EQ(single, parallel);
+  for (size_t route = 0; route < routes.size(); ++route) {
+    EXPECT_LE(RouteCost(matrix, single[route]),
+              RouteCost(matrix, routes[route]));
+  }
+  EXPECT_EQ(single[2], routes[2]);
+}
+} // namespace
+} // namespace constraint_solver
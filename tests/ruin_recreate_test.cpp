@@ -0,0 +1,155 @@
+#include "ruin_recreate.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+namespace {
+using Routes = std::vector<std::vector<int64_t>>;
+
+// Depot 0 in the middle of two clusters of customers: odd ones near (0, 0)
+// and even ones near (100, 100).
+FlatMatrix ClusterMatrix(int num_customers) {
+  std::vector<double> x = {50}, y = {50};
+  for (int customer = 1; customer <= num_customers; ++customer) {
+    const double offset = customer % 2 == 0 ? 100 : 0;
+    x.push_back(offset + (customer * 7) % 11);
+    y.push_back(offset + (customer * 5) % 13);
+  }
+  FlatMatrix matrix;
+  matrix.Resize(x.size());
+  for (size_t from = 0; from < x.size(); ++from) {
+    for (size_t to = 0; to < x.size(); ++to) {
+      matrix.Row(from)[to] =
+          std::lround(10 * std::hypot(x[from] - x[to], y[from] - y[to]));
+    }
+  }
+  return matrix;
+}
+
+// Both routes alternate between the clusters.
+Routes AlternatingRoutes(int num_customers) {
+  Routes routes(2, {0});
+  for (int customer = 1; customer <= num_customers; ++customer) {
+    routes[(customer - 1) / 2 % 2].push_back(customer);
+  }
+  for (std::vector<int64_t> &route : routes) {
+    route.push_back(0);
+  }
+  return routes;
+}
+
+int64_t TotalCost(const FlatMatrix &matrix, const Routes &routes) {
+  int64_t cost = 0;
+  for (const std::vector<int64_t> &route : routes) {
+    for (size_t i = 1; i < route.size(); ++i) {
+      cost += matrix(route[i - 1], route[i]);
+    }
+  }
+  return cost;
+}
+
+// Routes keep their ends and visit the same customers once between them.
+void ExpectSameVisits(const Routes &before, const Routes &after) {
+  ASSERT_EQ(after.size(), before.size());
+  std::vector<int64_t> customers_before, customers_after;
+  for (size_t route = 0; route < before.size(); ++route) {
+    EXPECT_EQ(after[route].front(), before[route].front());
+    EXPECT_EQ(after[route].back(), before[route].back());
+    customers_before.insert(customers_before.end(), before[route].begin() + 1,
+                            before[route].end() - 1);
+    customers_after.insert(customers_after.end(), after[route].begin() + 1,
+                           after[route].end() - 1);
+  }
+  std::sort(customers_before.begin(), customers_before.end());
+  std::sort(customers_after.begin(), customers_after.end());
+  EXPECT_EQ(customers_after, customers_before);
+}
+
+TEST(RuinAndRecreateTest, SeparatesClusters) {
+  const FlatMatrix matrix = ClusterMatrix(12);
+  const Routes initial = AlternatingRoutes(12);
+  Routes routes = initial;
+  // Without capacities a single route through both clusters costs about
+  // the same as two.
+  const std::vector<int64_t> demands(13, 1);
+  const std::vector<int64_t> capacities = {6, 6};
+  RuinRecreateOptions options;
+  options.iterations = 2000;
+  options.num_threads = 2;
+  options.seed = 7;
+  ASSERT_TRUE(RuinAndRecreate(matrix, demands, capacities, options, &routes));
+  ExpectSameVisits(initial, routes);
+  EXPECT_LT(TotalCost(matrix, routes), TotalCost(matrix, initial));
+  // Every route ends up serving a single cluster.
+  for (const std::vector<int64_t> &route : routes) {
+    for (size_t i = 2; i + 1 < route.size(); ++i) {
+      EXPECT_EQ(route[i] % 2, route[1] % 2);
+    }
+  }
+}
+
+TEST(RuinAndRecreateTest, RespectsCapacities) {
+  const FlatMatrix matrix = ClusterMatrix(8);
+  // A route can carry one cluster, but never more than four customers.
+  const std::vector<int64_t> demands = {0, 1, 1, 1, 1, 1, 1, 1, 1};
+  const std::vector<int64_t> capacities = {4, 4, 4};
+  Routes initial = AlternatingRoutes(8);
+  initial.push_back({0, 0});
+  Routes routes = initial;
+  RuinRecreateOptions options;
+  options.iterations = 1000;
+  options.num_threads = 1;
+  RuinAndRecreate(matrix, demands, capacities, options, &routes);
+  ExpectSameVisits(initial, routes);
+  EXPECT_LE(TotalCost(matrix, routes), TotalCost(matrix, initial));
+  for (size_t route = 0; route < routes.size(); ++route) {
+    int64_t load = 0;
+    for (int64_t node : routes[route]) {
+      load += demands[node];
+    }
+    EXPECT_LE(load, capacities[route]) << "route " << route;
+  }
+}
+
+TEST(RuinAndRecreateTest, IsReproducibleForSeedAndThreads) {
+  const FlatMatrix matrix = ClusterMatrix(16);
+  RuinRecreateOptions options;
+  options.iterations = 600;
+  options.num_threads = 3;
+  options.seed = 42;
+  options.max_ruined = 5;
+  Routes first = AlternatingRoutes(16);
+  Routes second = first;
+  RuinAndRecreate(matrix, {}, {}, options, &first);
+  RuinAndRecreate(matrix, {}, {}, options, &second);
+  EXPECT_EQ(first, second);
+}
+
+TEST(RuinAndRecreateTest, LeavesRoutesWithoutImprovementAlone) {
+  const FlatMatrix matrix = ClusterMatrix(4);
+  RuinRecreateOptions options;
+  options.num_threads = 1;
+  Routes empty = {{0, 0}, {0, 0}};
+  EXPECT_FALSE(RuinAndRecreate(matrix, {}, {}, options, &empty));
+  EXPECT_EQ(empty, (Routes{{0, 0}, {0, 0}}));
+
+  Routes routes = AlternatingRoutes(4);
+  const Routes initial = routes;
+  options.iterations = 0;
+  EXPECT_FALSE(RuinAndRecreate(matrix, {}, {}, options, &routes));
+  EXPECT_EQ(routes, initial);
+
+  // Full routes can only swap customers, which costs the same.
+  Routes single = {{0, 1, 0}, {0, 2, 0}};
+  options.iterations = 100;
+  EXPECT_FALSE(RuinAndRecreate(matrix, {0, 1, 1}, {1, 1}, options, &single));
+  EXPECT_EQ(single, (Routes{{0, 1, 0}, {0, 2, 0}}));
+}
+} // namespace
+} // namespace constraint_solver
@@ -0,0 +1,240 @@
+#include "solution_export.h"
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace constraint_solver {
+namespace {
+std::string Bytes(std::initializer_list<int> values) {
+  std::string bytes;
+  for (int value : values) {
+    bytes.push_back(static_cast<char>(value));
+  }
+  return bytes;
+}
+
+// Runs fill against a sink over a buffer large enough for everything.
+template <typename Fill> std::string Export(Fill fill) {
+  std::string buffer(1 << 20, '\0');
+  ExportSink sink(buffer.data(), buffer.size());
+  fill(&sink);
+  EXPECT_TRUE(sink.Finish());
+  buffer.resize(sink.size());
+  return buffer;
+}
+
+class VarintReader {
+public:
+  explicit VarintReader(const std::string &bytes) : bytes(bytes) {}
+
+  uint64_t Varint() {
+    uint64_t value = 0;
+    for (int shift = 0; position < bytes.size(); shift += 7) {
+      const uint8_t byte = bytes[position++];
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (byte < 0x80) {
+        break;
+      }
+    }
+    return value;
+  }
+  int64_t ZigZag() {
+    const uint64_t value = Varint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+  bool done() const { return position == bytes.size(); }
+
+private:
+  const std::string &bytes;
+  size_t position = 0;
+};
+
+TEST(ExportSinkTest, EncodesVarints) {
+  EXPECT_EQ(Export([](ExportSink *sink) { sink->AppendVarint(0); }),
+            Bytes({0x00}));
+  EXPECT_EQ(Export([](ExportSink *sink) { sink->AppendVarint(127); }),
+            Bytes({0x7f}));
+  EXPECT_EQ(Export([](ExportSink *sink) { sink->AppendVarint(128); }),
+            Bytes({0x80, 0x01}));
+  EXPECT_EQ(Export([](ExportSink *sink) { sink->AppendVarint(300); }),
+            Bytes({0xac, 0x02}));
+  EXPECT_EQ(Export([](ExportSink *sink) {
+              sink->AppendVarint(std::numeric_limits<uint64_t>::max());
+            }),
+            Bytes({0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01}));
+}
+
+TEST(ExportSinkTest, ZigZagKeepsSmallMagnitudesShort) {
+  EXPECT_EQ(Export([](ExportSink *sink) {
+              sink->AppendZigZag(0);
+              sink->AppendZigZag(-1);
+              sink->AppendZigZag(1);
+              sink->AppendZigZag(-64);
+            }),
+            Bytes({0x00, 0x01, 0x02, 0x7f}));
+  const std::string extremes = Export([](ExportSink *sink) {
+    sink->AppendZigZag(std::numeric_limits<int64_t>::min());
+    sink->AppendZigZag(std::numeric_limits<int64_t>::max());
+  });
+  VarintReader reader(extremes);
+  EXPECT_EQ(reader.ZigZag(), std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(reader.ZigZag(), std::numeric_limits<int64_t>::max());
+  EXPECT_TRUE(reader.done());
+}
+
+TEST(ExportSinkTest, WritesShortestDecimals) {
+  EXPECT_EQ(Export([](ExportSink *sink) {
+              sink->AppendDecimal(int64_t{-42});
+              sink->Append(' ');
+              sink->AppendDecimal(0.1);
+              sink->Append(' ');
+              sink->AppendDecimal(-71.0625);
+              sink->Append(' ');
+              sink->AppendDecimal(3.0);
+            }),
+            "-42 0.1 -71.0625 3");
+}
+
+TEST(ExportSinkTest, CountsBytesBeyondCapacity) {
+  char buffer[4] = {'x', 'x', 'x', 'x'};
+  ExportSink sink(buffer, 3);
+  sink.Append("ab", 2);
+  sink.Append("cde", 3);
+  sink.Append('f');
+  EXPECT_TRUE(sink.Finish());
+  EXPECT_EQ(sink.size(), 6);
+  EXPECT_EQ(std::string(buffer, 4), "abcx");
+
+  char unused;
+  ExportSink empty(&unused, 0);
+  empty.AppendVarint(300);
+  EXPECT_EQ(empty.size(), 2);
+}
+
+TEST(ExportSinkTest, FileMatchesBuffer) {
+  // Small appends fill the chunk several times over, and one piece larger
+  // than the chunk bypasses it.
+  auto fill = [](ExportSink *sink) {
+    for (int64_t i = 0; i < 50000; ++i) {
+      sink->AppendVarint(i * 37);
+    }
+    const std::string large(100000, 'z');
+    sink->Append(large.data(), large.size());
+    sink->AppendZigZag(-5);
+  };
+  const std::string expected = Export(fill);
+
+  const std::string path = testing::TempDir() + "/export_sink_test.bin";
+  std::FILE *file = std::fopen(path.c_str(), "w+b");
+  ASSERT_NE(file, nullptr);
+  {
+    ExportSink sink(fileno(file));
+    fill(&sink);
+    EXPECT_TRUE(sink.Finish());
+    EXPECT_EQ(sink.size(), static_cast<int64_t>(expected.size()));
+  }
+  std::string written(expected.size() + 1, '\0');
+  std::rewind(file);
+  written.resize(std::fread(written.data(), 1, written.size(), file));
+  std::fclose(file);
+  std::remove(path.c_str());
+  EXPECT_EQ(written, expected);
+}
+
+TEST(ExportSinkTest, ReportsFailedWrites) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  close(fds[0]);
+  ExportSink sink(fds[1]);
+  sink.Append("abc", 3);
+  // A closed pipe raises SIGPIPE unless it is ignored.
+  std::signal(SIGPIPE, SIG_IGN);
+  EXPECT_FALSE(sink.Finish());
+  close(fds[1]);
+}
+
+TEST(BinaryRouteExporterTest, RoundTripsRoutesAndCumuls) {
+  const std::vector<std::vector<int64_t>> routes = {{0, 3, 1, 0}, {0, 0}};
+  const std::vector<std::vector<int64_t>> cumuls = {{0, 120, 90, 400},
+                                                    {5, 5}};
+  const std::string bytes = Export([&](ExportSink *sink) {
+    BinaryRouteExporter exporter(sink);
+    exporter.Begin(-7, routes.size(), true);
+    for (size_t vehicle = 0; vehicle < routes.size(); ++vehicle) {
+      exporter.Route(vehicle, routes[vehicle], cumuls[vehicle]);
+    }
+    exporter.End();
+  });
+
+  VarintReader reader(bytes);
+  EXPECT_EQ(reader.Varint(), 1);
+  EXPECT_EQ(reader.ZigZag(), -7);
+  EXPECT_EQ(reader.Varint(), 1);
+  ASSERT_EQ(reader.Varint(), routes.size());
+  for (size_t vehicle = 0; vehicle < routes.size(); ++vehicle) {
+    ASSERT_EQ(reader.Varint(), routes[vehicle].size());
+    int64_t cumul = 0;
+    for (size_t i = 0; i < routes[vehicle].size(); ++i) {
+      EXPECT_EQ(static_cast<int64_t>(reader.Varint()), routes[vehicle][i]);
+      cumul += reader.ZigZag();
+      EXPECT_EQ(cumul, cumuls[vehicle][i]);
+    }
+  }
+  EXPECT_TRUE(reader.done());
+}
+
+TEST(BinaryRouteExporterTest, OmitsCumulsWhenEmpty) {
+  const std::string bytes = Export([](ExportSink *sink) {
+    BinaryRouteExporter exporter(sink);
+    exporter.Begin(300, 1, false);
+    exporter.Route(0, {0, 200, 0}, {});
+  });
+  // 300 zigzags to 600: 0xd8 0x04. Node 200 is 0xc8 0x01.
+  EXPECT_EQ(bytes, Bytes({0x01, 0xd8, 0x04, 0x00, 0x01, 0x03, 0x00, 0xc8,
+                          0x01, 0x00}));
+}
+
+TEST(GeoJsonRouteExporterTest, WritesFeaturePerUsedVehicle) {
+  const std::vector<double> longitudes = {4.5, 4.25, -0.1};
+  const std::vector<double> latitudes = {51, 52.125, 50.5};
+  const std::string json = Export([&](ExportSink *sink) {
+    GeoJsonRouteExporter exporter(sink, longitudes, latitudes);
+    exporter.Begin(12, 3, true);
+    exporter.Route(0, {0, 0}, {0, 0});
+    exporter.Route(1, {0, 1, 0}, {0, 10, 25});
+    exporter.Route(2, {0, 2, 1, 0}, {0, 3, 8, 30});
+    exporter.End();
+  });
+  EXPECT_EQ(json,
+            "{\"type\":\"FeatureCollection\",\"properties\":{\"objective\":12},"
+            "\"features\":["
+            "{\"type\":\"Feature\",\"geometry\":{\"type\":\"LineString\","
+            "\"coordinates\":[[4.5,51],[4.25,52.125],[4.5,51]]},"
+            "\"properties\":{\"vehicle\":1,\"nodes\":[0,1,0],"
+            "\"cumuls\":[0,10,25]}},"
+            "{\"type\":\"Feature\",\"geometry\":{\"type\":\"LineString\","
+            "\"coordinates\":[[4.5,51],[-0.1,50.5],[4.25,52.125],[4.5,51]]},"
+            "\"properties\":{\"vehicle\":2,\"nodes\":[0,2,1,0],"
+            "\"cumuls\":[0,3,8,30]}}]}");
+}
+
+TEST(GeoJsonRouteExporterTest, WritesEmptyCollection) {
+  const std::vector<double> coordinates = {0};
+  const std::string json = Export([&](ExportSink *sink) {
+    GeoJsonRouteExporter exporter(sink, coordinates, coordinates);
+    exporter.Begin(0, 1, false);
+    exporter.Route(0, {0, 0}, {});
+    exporter.End();
+  });
+  EXPECT_EQ(json, "{\"type\":\"FeatureCollection\",\"properties\":"
+                  "{\"objective\":0},\"features\":[]}");
+}
+} // namespace
+} // namespace constraint_solver
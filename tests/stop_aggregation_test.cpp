@@ -0,0 +1,85 @@
+#include "stop_aggregation.h"
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "flat_matrix.h"
+
+namespace constraint_solver {
+namespace {
+constexpr int64_t kNoLimit = std::numeric_limits<int64_t>::max();
+
+// Nodes at the given positions on a line.
+FlatMatrix PositionMatrix(const std::vector<int64_t> &positions) {
+  const int num_nodes = positions.size();
+  FlatMatrix matrix;
+  matrix.Resize(num_nodes);
+  for (int from = 0; from < num_nodes; ++from) {
+    for (int to = 0; to < num_nodes; ++to) {
+      matrix.Row(from)[to] = std::abs(positions[from] - positions[to]);
+    }
+  }
+  return matrix;
+}
+
+TEST(FindColocatedStopsTest, GroupsZeroDistanceNodes) {
+  // Node 0 is the depot, at the same place as nodes 1 and 4.
+  const FlatMatrix matrix = PositionMatrix({0, 0, 5, 5, 0, 7, 5});
+  std::vector<bool> fixed(7, false);
+  fixed[0] = true;
+  const StopGroups groups =
+      FindColocatedStops(matrix, {}, {}, {}, {}, kNoLimit, fixed);
+  EXPECT_EQ(groups.node_group, (std::vector<int>{0, 1, 2, 2, 1, 3, 2}));
+  EXPECT_EQ(groups.group_nodes, (std::vector<std::vector<int>>{
+                                    {0}, {1, 4}, {2, 3, 6}, {5}}));
+}
+
+TEST(FindColocatedStopsTest, NeedsZeroDistanceBothWays) {
+  FlatMatrix matrix(3, {0, 4, 4, 4, 0, 0, 4, 3, 0});
+  const StopGroups groups = FindColocatedStops(
+      matrix, {}, {}, {}, {}, kNoLimit, std::vector<bool>(3, false));
+  EXPECT_EQ(groups.group_nodes.size(), 3);
+}
+
+TEST(FindColocatedStopsTest, GroupsIdenticalCoordinates) {
+  // Distances alone would not group anything.
+  const FlatMatrix matrix = PositionMatrix({0, 1, 2, 3, 4});
+  const std::vector<double> longitudes = {4.5, 4.25, 4.5, 4.25, 4.5};
+  const std::vector<double> latitudes = {51, 52, 51, 52, 50};
+  const StopGroups groups =
+      FindColocatedStops(matrix, longitudes, latitudes, {}, {}, kNoLimit,
+                         std::vector<bool>(5, false));
+  EXPECT_EQ(groups.node_group, (std::vector<int>{0, 1, 0, 1, 2}));
+}
+
+TEST(FindColocatedStopsTest, KeepsZonesApart) {
+  const FlatMatrix matrix = PositionMatrix({0, 0, 0, 0});
+  const StopGroups groups =
+      FindColocatedStops(matrix, {}, {}, {1, 2, 1, 2}, {}, kNoLimit,
+                         std::vector<bool>(4, false));
+  EXPECT_EQ(groups.node_group, (std::vector<int>{0, 1, 0, 1}));
+}
+
+TEST(FindColocatedStopsTest, SplitsLocationsHeavierThanLimit) {
+  const FlatMatrix matrix = PositionMatrix({0, 0, 0, 0, 0});
+  const StopGroups groups =
+      FindColocatedStops(matrix, {}, {}, {}, {4, 3, 3, 2, 6}, 7,
+                         std::vector<bool>(5, false));
+  // 4 + 3 fills the first group; 3 + 2 fit in the second, 6 does not.
+  EXPECT_EQ(groups.node_group, (std::vector<int>{0, 0, 1, 1, 2}));
+  EXPECT_EQ(SumByGroup(groups, {4, 3, 3, 2, 6}),
+            (std::vector<int64_t>{7, 5, 6}));
+}
+
+TEST(SumByGroupTest, SumsValuesOfEveryGroup) {
+  StopGroups groups;
+  groups.node_group = {0, 1, 0, 2, 1};
+  groups.group_nodes = {{0, 2}, {1, 4}, {3}};
+  EXPECT_EQ(SumByGroup(groups, {10, 1, 20, 5, -1}),
+            (std::vector<int64_t>{30, 0, 5}));
+}
+} // namespace
+} // namespace constraint_solver
@@ -0,0 +1,179 @@
+// Package vrp solves vehicle routing problems with a single call into the C++
+// solver. The whole problem is encoded into one buffer and the routes come
+// back the same way, so a solve pays the cgo overhead once and never leaves a
+// half-built model behind.
+package vrp
+
+import (
+	"encoding/binary"
+	"errors"
+	"time"
+
+	"vrp/constraint_solver"
+)
+
+// bufferVersion must match kBufferVersion in constraint_solver/solve.cpp.
+const bufferVersion = 1
+
+// DefaultSolutionLimit is the solution limit of a deterministic solve whose
+// Options leave SolutionLimit at 0.
+const DefaultSolutionLimit = 1000
+
+// Problem describes a routing problem.
+type Problem struct {
+	NumNodes    int
+	NumVehicles int
+	Depot       int
+	// Distances is the row-major NumNodes x NumNodes distance matrix.
+	Distances []int64
+	// Starts and Ends optionally give every vehicle its own start and end
+	// node. Leave them nil for a single depot.
+	Starts []int
+	Ends   []int
+	// MaxRouteDistance bounds the length of every route; 0 means unbounded.
+	MaxRouteDistance int64
+}
+
+// Options controls the search.
+type Options struct {
+	// FirstSolutionStrategy is one of the names accepted by
+	// RoutingWrapper.SetFirstSolutionStrategy; empty means "AUTOMATIC".
+	FirstSolutionStrategy string
+	// TimeLimit of the search; 0 means no limit.
+	TimeLimit time.Duration
+	// Deterministic replaces TimeLimit by SolutionLimit, which defaults to
+	// DefaultSolutionLimit when 0, and makes the solve reproducible for Seed.
+	Deterministic bool
+	Seed          int32
+	SolutionLimit int64
+	// ImproveNeighbors enables the post-solve route improvement with that
+	// many neighbors per node.
+	ImproveNeighbors int
+	ImproveThreads   int
+}
+
+// Result is the solution of a Problem.
+type Result struct {
+	Objective int64
+	// Routes holds the nodes of every vehicle, start and end included.
+	Routes [][]int
+}
+
+var (
+	ErrInvalidProblem = errors.New("vrp: invalid problem")
+	ErrNoSolution     = errors.New("vrp: no solution found")
+)
+
+// Solve solves p with the options o, which may be nil.
+func Solve(p *Problem, o *Options) (*Result, error) {
+	if o == nil {
+		o = &Options{}
+	}
+	if len(p.Distances) != p.NumNodes*p.NumNodes || len(p.Starts) != len(p.Ends) {
+		return nil, ErrInvalidProblem
+	}
+	return decodeResult(constraint_solver.SolveBuffer(encodeRequest(p, o)))
+}
+
+type encoder struct {
+	buf []byte
+}
+
+func (e *encoder) int(v int64) {
+	e.buf = binary.LittleEndian.AppendUint64(e.buf, uint64(v))
+}
+
+func encodeRequest(p *Problem, o *Options) []byte {
+	strategy := o.FirstSolutionStrategy
+	if strategy == "" {
+		strategy = "AUTOMATIC"
+	}
+	solutionLimit := o.SolutionLimit
+	if solutionLimit == 0 {
+		solutionLimit = DefaultSolutionLimit
+	}
+	words := 16 + 2*len(p.Starts) + len(p.Distances)
+	e := encoder{buf: make([]byte, 0, 8*words+len(strategy))}
+	e.int(bufferVersion)
+	e.int(int64(p.NumNodes))
+	e.int(int64(p.NumVehicles))
+	e.int(int64(p.Depot))
+	e.int(p.MaxRouteDistance)
+	e.int(int64(len(p.Starts)))
+	for _, node := range p.Starts {
+		e.int(int64(node))
+	}
+	for _, node := range p.Ends {
+		e.int(int64(node))
+	}
+	for _, d := range p.Distances {
+		e.int(d)
+	}
+	e.int(o.TimeLimit.Milliseconds())
+	if o.Deterministic {
+		e.int(1)
+	} else {
+		e.int(0)
+	}
+	e.int(int64(o.Seed))
+	e.int(solutionLimit)
+	e.int(int64(o.ImproveNeighbors))
+	e.int(int64(o.ImproveThreads))
+	e.int(int64(len(strategy)))
+	e.buf = append(e.buf, strategy...)
+	return e.buf
+}
+
+type decoder struct {
+	buf string
+	err error
+}
+
+func (d *decoder) int() int64 {
+	if len(d.buf) < 8 {
+		d.err = ErrInvalidProblem
+		return 0
+	}
+	var v uint64
+	for i := 7; i >= 0; i-- {
+		v = v<<8 | uint64(d.buf[i])
+	}
+	d.buf = d.buf[8:]
+	return int64(v)
+}
+
+// count reads a length and checks that many words can follow.
+func (d *decoder) count() int {
+	n := d.int()
+	if n < 0 || n > int64(len(d.buf)/8) {
+		d.err = ErrInvalidProblem
+		return 0
+	}
+	return int(n)
+}
+
+func decodeResult(response string) (*Result, error) {
+	d := decoder{buf: response}
+	status := d.int()
+	switch {
+	case d.err != nil:
+		return nil, d.err
+	case status == -1:
+		return nil, ErrInvalidProblem
+	case status == 0:
+		return nil, ErrNoSolution
+	}
+	r := &Result{Objective: d.int()}
+	r.Routes = make([][]int, d.count())
+	for v := range r.Routes {
+		route := make([]int, d.count())
+		for i := range route {
+			route[i] = int(d.int())
+		}
+		r.Routes[v] = route
+	}
+	if d.err != nil {
+		return nil, d.err
+	}
+	return r, nil
+}
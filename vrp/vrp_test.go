@@ -0,0 +1,70 @@
+package vrp
+
+import (
+	"encoding/binary"
+	"errors"
+	"reflect"
+	"testing"
+	"time"
+)
+
+func words(values ...int64) []byte {
+	var buf []byte
+	for _, v := range values {
+		buf = binary.LittleEndian.AppendUint64(buf, uint64(v))
+	}
+	return buf
+}
+
+func TestEncodeRequest(t *testing.T) {
+	p := &Problem{
+		NumNodes:         2,
+		NumVehicles:      1,
+		Distances:        []int64{0, 3, 4, 0},
+		Starts:           []int{1},
+		Ends:             []int{0},
+		MaxRouteDistance: 10,
+	}
+	o := &Options{
+		TimeLimit:        2 * time.Second,
+		Deterministic:    true,
+		Seed:             -5,
+		ImproveNeighbors: 4,
+		ImproveThreads:   2,
+	}
+	want := words(bufferVersion, 2, 1, 0, 10, 1, 1, 0, 0, 3, 4, 0,
+		2000, 1, -5, DefaultSolutionLimit, 4, 2, 9)
+	want = append(want, "AUTOMATIC"...)
+	if got := encodeRequest(p, o); !reflect.DeepEqual(got, want) {
+		t.Errorf("encodeRequest() = %v, want %v", got, want)
+	}
+}
+
+func TestDecodeResult(t *testing.T) {
+	r, err := decodeResult(string(words(1, 42, 2, 3, 0, 2, 0, 2, 0, 0)))
+	if err != nil {
+		t.Fatalf("decodeResult() error = %v", err)
+	}
+	want := &Result{Objective: 42, Routes: [][]int{{0, 2, 0}, {0, 0}}}
+	if !reflect.DeepEqual(r, want) {
+		t.Errorf("decodeResult() = %+v, want %+v", r, want)
+	}
+}
+
+func TestDecodeResultErrors(t *testing.T) {
+	for _, tc := range []struct {
+		name     string
+		response []byte
+		want     error
+	}{
+		{"invalid", words(-1, 0, 0), ErrInvalidProblem},
+		{"no solution", words(0, 0, 0), ErrNoSolution},
+		{"empty", nil, ErrInvalidProblem},
+		{"truncated route", words(1, 7, 1, 3, 0, 1), ErrInvalidProblem},
+		{"negative count", words(1, 7, -1), ErrInvalidProblem},
+	} {
+		if _, err := decodeResult(string(tc.response)); !errors.Is(err, tc.want) {
+			t.Errorf("%s: decodeResult() error = %v, want %v", tc.name, err, tc.want)
+		}
+	}
+}